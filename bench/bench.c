@@ -0,0 +1,349 @@
+/* generated-code benchmark.
+   compiles every kernel with lsysc, assembles it, runs it and counts what the
+   emitted code costs: instructions retired, cycles, branch misses and L1D
+   read misses through perf_event_open (user space of the kernel only, from
+   exec to exit), plus rdtsc as a fallback when counters are not available.
+   the tsc probe is patched into the generated assembly around the program
+   body and reports through fd 3, so process startup stays out of it. each
+   kernel runs -r times and keeps the minimum; the cost of an empty program
+   (probe included) is subtracted so only the kernel's own code remains.
+   results are compared against per-kernel baselines.
+
+   unlike lsysc this is a hosted tool: it needs fork/exec and a libc is fine */
+
+#define _GNU_SOURCE
+#include <linux/perf_event.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+enum { C_INSNS, C_CYCLES, C_BRMISS, C_L1DMISS, C_TSC, C_COUNT };
+
+#define NA UINT64_MAX      /* counter not available */
+#define MAX_KERNELS 256
+#define MAX_EXTRA 16
+
+static const char* counter_names[C_COUNT] = { "insns", "cycles", "br-miss", "l1d-miss", "tsc" };
+
+typedef struct {
+    char name[64];
+    uint64_t v[C_COUNT];
+} result_t;
+
+static const char* lsysc = "build/lsysc";
+static const char* work_dir = "build/bench";
+static const char* extra[MAX_EXTRA];   /* extra lsysc options */
+static int nextra;
+
+static const char probe_start[] = "_start:\n";
+static const char probe_exit[] = "    mov rax, 60\n    xor rdi, rdi\n    syscall\n";
+static const char tsc_read[] =
+    "    lfence\n"
+    "    rdtsc\n"
+    "    shl rdx, 32\n"
+    "    or rax, rdx\n";
+
+/* bracket the program body with rdtsc; the delta goes to fd 3 just before exit */
+static int add_tsc_probe(const char* asm_path) {
+    FILE* f = fopen(asm_path, "r");
+    if (!f) return -1;
+    fseek(f, 0, SEEK_END);
+    long len = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    char* text = malloc((size_t) len + 1);
+    if (!text || fread(text, 1, (size_t) len, f) != (size_t) len) { fclose(f); free(text); return -1; }
+    fclose(f);
+    text[len] = '\0';
+
+    char* start = strstr(text, probe_start);
+    char* exit_seq = start ? strstr(start, probe_exit) : NULL;
+    if (!exit_seq) { free(text); return -1; }
+    start += sizeof(probe_start) - 1;
+
+    f = fopen(asm_path, "w");
+    if (!f) { free(text); return -1; }
+    fwrite(text, 1, (size_t) (start - text), f);
+    fprintf(f, "%s    mov qword ptr [rip + lsys_bench_tsc], rax\n", tsc_read);
+    fwrite(start, 1, (size_t) (exit_seq - start), f);
+    fprintf(f, "%s"
+               "    sub rax, qword ptr [rip + lsys_bench_tsc]\n"
+               "    mov qword ptr [rip + lsys_bench_tsc], rax\n"
+               "    mov rax, 1\n"
+               "    mov rdi, 3\n"
+               "    lea rsi, [rip + lsys_bench_tsc]\n"
+               "    mov rdx, 8\n"
+               "    syscall\n", tsc_read);
+    fputs(exit_seq, f);
+    fputs(".section .data\nlsys_bench_tsc:\n    .quad 0\n", f);
+    free(text);
+    return fclose(f);
+}
+
+/* run argv to completion; returns its exit status, -1 if it did not exit */
+static int run_cmd(char* const argv[]) {
+    pid_t pid = fork();
+    if (pid < 0) return -1;
+    if (pid == 0) {
+        execvp(argv[0], argv);
+        _exit(127);
+    }
+    int st;
+    if (waitpid(pid, &st, 0) < 0 || !WIFEXITED(st)) return -1;
+    return WEXITSTATUS(st);
+}
+
+/* kernel.ls -> <work_dir>/<name>, returns 0 on success */
+static int build_kernel(const char* src, const char* name, char* exe, size_t exe_len) {
+    char asm_path[512];
+    snprintf(asm_path, sizeof(asm_path), "%s/%s.s", work_dir, name);
+    snprintf(exe, exe_len, "%s/%s", work_dir, name);
+
+    char* argv[MAX_EXTRA + 4];
+    int n = 0;
+    argv[n++] = (char*) lsysc;
+    for (int i = 0; i < nextra; ++i) argv[n++] = (char*) extra[i];
+    argv[n++] = (char*) src;
+    argv[n++] = asm_path;
+    argv[n] = NULL;
+    if (run_cmd(argv) != 0) {
+        fprintf(stderr, "bench: %s: lsysc failed\n", src);
+        return -1;
+    }
+    if (add_tsc_probe(asm_path) != 0) {
+        fprintf(stderr, "bench: %s: no exit sequence to put the tsc probe on\n", src);
+        return -1;
+    }
+    const char* cc = getenv("CC");
+    char* as_argv[] = { (char*) (cc ? cc : "gcc"), "-nostdlib", "-static", "-o", exe, asm_path, NULL };
+    if (run_cmd(as_argv) != 0) {
+        fprintf(stderr, "bench: %s: assembling failed\n", src);
+        return -1;
+    }
+    return 0;
+}
+
+static int counter_open(pid_t pid, uint32_t type, uint64_t config) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.disabled = 1;
+    attr.enable_on_exec = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return (int) syscall(SYS_perf_event_open, &attr, pid, -1, -1, PERF_FLAG_FD_CLOEXEC);
+}
+
+/* one run of exe; the child waits on a pipe until its counters are attached
+   and sends its tsc delta back on another */
+static int run_once(const char* exe, uint64_t v[C_COUNT]) {
+    static const struct { uint32_t type; uint64_t config; } events[C_TSC] = {
+        { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+        { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+        { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+        { PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                              (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) },
+    };
+    int go[2], tsc[2];
+    if (pipe(go) < 0) return -1;
+    if (pipe(tsc) < 0) { close(go[0]); close(go[1]); return -1; }
+    pid_t pid = fork();
+    if (pid < 0) return -1;
+    if (pid == 0) {
+        char c;
+        close(go[1]);
+        close(tsc[0]);
+        if (read(go[0], &c, 1) != 1 || dup2(tsc[1], 3) < 0) _exit(127);
+        execl(exe, exe, (char*) NULL);
+        _exit(127);
+    }
+    close(go[0]);
+    close(tsc[1]);
+    int fds[C_TSC];
+    for (int i = 0; i < C_TSC; ++i) fds[i] = counter_open(pid, events[i].type, events[i].config);
+
+    (void) !write(go[1], "x", 1);
+    close(go[1]);
+    int st;
+    int ok = waitpid(pid, &st, 0) == pid && WIFEXITED(st) && WEXITSTATUS(st) == 0;
+    if (read(tsc[0], &v[C_TSC], sizeof(v[C_TSC])) != (ssize_t) sizeof(v[C_TSC])) ok = 0;
+    close(tsc[0]);
+
+    for (int i = 0; i < C_TSC; ++i) {
+        v[i] = NA;
+        if (fds[i] < 0) continue;
+        uint64_t val;
+        if (read(fds[i], &val, sizeof(val)) == (ssize_t) sizeof(val)) v[i] = val;
+        close(fds[i]);
+    }
+    if (!ok) fprintf(stderr, "bench: %s did not exit cleanly\n", exe);
+    return ok ? 0 : -1;
+}
+
+/* minimum of each counter over reps runs */
+static int measure(const char* exe, int reps, uint64_t v[C_COUNT]) {
+    for (int i = 0; i < C_COUNT; ++i) v[i] = NA;
+    for (int r = 0; r < reps; ++r) {
+        uint64_t cur[C_COUNT];
+        if (run_once(exe, cur) != 0) return -1;
+        for (int i = 0; i < C_COUNT; ++i) {
+            if (cur[i] != NA && (v[i] == NA || cur[i] < v[i])) v[i] = cur[i];
+        }
+    }
+    return 0;
+}
+
+/* "dir/name.ls" -> "name" */
+static void kernel_name(const char* path, char* out, size_t out_len) {
+    const char* base = strrchr(path, '/');
+    base = base ? base + 1 : path;
+    size_t n = strcspn(base, ".");
+    if (n >= out_len) n = out_len - 1;
+    memcpy(out, base, n);
+    out[n] = '\0';
+}
+
+/* baseline file: one "name insns cycles br-miss l1d-miss tsc" line per kernel, '-' = n/a */
+static int load_baseline(const char* path, result_t* base, int max) {
+    FILE* f = fopen(path, "r");
+    if (!f) return 0;
+    int n = 0;
+    char line[512];
+    while (n < max && fgets(line, sizeof(line), f)) {
+        if (line[0] == '#' || line[0] == '\n') continue;
+        result_t* r = &base[n];
+        char* tok = strtok(line, " \t\n");
+        if (!tok) continue;
+        snprintf(r->name, sizeof(r->name), "%s", tok);
+        for (int i = 0; i < C_COUNT; ++i) {
+            tok = strtok(NULL, " \t\n");
+            r->v[i] = (!tok || tok[0] == '-') ? NA : strtoull(tok, NULL, 10);
+        }
+        ++n;
+    }
+    fclose(f);
+    return n;
+}
+
+static int save_baseline(const char* path, const result_t* res, int n) {
+    char tmp[512];
+    snprintf(tmp, sizeof(tmp), "%s.tmp", path);
+    FILE* f = fopen(tmp, "w");
+    if (!f) return -1;
+    fprintf(f, "# kernel");
+    for (int i = 0; i < C_COUNT; ++i) fprintf(f, " %s", counter_names[i]);
+    fprintf(f, "\n");
+    for (int k = 0; k < n; ++k) {
+        fprintf(f, "%s", res[k].name);
+        for (int i = 0; i < C_COUNT; ++i) {
+            if (res[k].v[i] == NA) fprintf(f, " -");
+            else fprintf(f, " %llu", (unsigned long long) res[k].v[i]);
+        }
+        fprintf(f, "\n");
+    }
+    if (fclose(f) != 0) return -1;
+    return rename(tmp, path);
+}
+
+static const result_t* find_result(const result_t* res, int n, const char* name) {
+    for (int i = 0; i < n; ++i) if (strcmp(res[i].name, name) == 0) return &res[i];
+    return NULL;
+}
+
+static void usage(void) {
+    fprintf(stderr,
+            "usage: lsys-bench [-u] [-r reps (11)] [-t pct] [-b baseline] [-c lsysc] [-x lsysc-option]... kernel.ls...\n"
+            "  -u  write the results as the new baseline instead of comparing\n"
+            "  -t  fail when instructions grow by more than pct percent (default 1)\n");
+}
+
+int main(int argc, char** argv) {
+    const char* baseline_path = "bench/baseline.txt";
+    int update = 0, reps = 11;
+    double threshold = 1.0;
+    int opt;
+    while ((opt = getopt(argc, argv, "ur:t:b:c:x:")) != -1) {
+        switch (opt) {
+            case 'u': update = 1; break;
+            case 'r': reps = atoi(optarg); break;
+            case 't': threshold = atof(optarg); break;
+            case 'b': baseline_path = optarg; break;
+            case 'c': lsysc = optarg; break;
+            case 'x':
+                if (nextra < MAX_EXTRA) extra[nextra++] = optarg;
+                break;
+            default: usage(); return 2;
+        }
+    }
+    if (optind >= argc || reps < 1) { usage(); return 2; }
+    if (argc - optind > MAX_KERNELS) { fprintf(stderr, "bench: too many kernels\n"); return 2; }
+    mkdir(work_dir, 0755);
+
+    /* startup and exit cost, subtracted from every kernel */
+    char null_src[512], exe[512];
+    snprintf(null_src, sizeof(null_src), "%s/null.ls", work_dir);
+    FILE* nf = fopen(null_src, "w");
+    if (!nf) { perror("bench: null kernel"); return 2; }
+    fputs("x = 0;\n", nf);
+    fclose(nf);
+    uint64_t null_v[C_COUNT];
+    if (build_kernel(null_src, "null", exe, sizeof(exe)) != 0 || measure(exe, reps, null_v) != 0) return 2;
+    if (null_v[C_INSNS] == NA) fprintf(stderr, "bench: hardware counters unavailable, rdtsc only\n");
+
+    static result_t res[MAX_KERNELS];
+    static result_t base[MAX_KERNELS];
+    int nbase = load_baseline(baseline_path, base, MAX_KERNELS);
+    int nres = 0, failed = 0, regressed = 0;
+
+    printf("%-16s", "kernel");
+    for (int i = 0; i < C_COUNT; ++i) printf(" %20s", counter_names[i]);
+    printf("\n");
+    for (int a = optind; a < argc; ++a) {
+        result_t* r = &res[nres];
+        kernel_name(argv[a], r->name, sizeof(r->name));
+        if (build_kernel(argv[a], r->name, exe, sizeof(exe)) != 0 || measure(exe, reps, r->v) != 0) {
+            failed = 1;
+            continue;
+        }
+        for (int i = 0; i < C_COUNT; ++i) {
+            if (r->v[i] == NA || null_v[i] == NA) continue;
+            r->v[i] = r->v[i] > null_v[i] ? r->v[i] - null_v[i] : 0;
+        }
+        ++nres;
+
+        const result_t* b = update ? NULL : find_result(base, nbase, r->name);
+        printf("%-16s", r->name);
+        for (int i = 0; i < C_COUNT; ++i) {
+            char cell[48];
+            if (r->v[i] == NA) snprintf(cell, sizeof(cell), "-");
+            else if (!b || b->v[i] == NA || b->v[i] == 0) snprintf(cell, sizeof(cell), "%llu", (unsigned long long) r->v[i]);
+            else {
+                double d = 100.0 * ((double) r->v[i] - (double) b->v[i]) / (double) b->v[i];
+                /* instruction counts are deterministic, the rest is noise-prone */
+                int bad = i == C_INSNS && d > threshold;
+                regressed |= bad;
+                snprintf(cell, sizeof(cell), "%llu %+.1f%%%s", (unsigned long long) r->v[i], d, bad ? "!" : "");
+            }
+            printf(" %20s", cell);
+        }
+        printf("\n");
+    }
+
+    if (update) {
+        /* kernels not run this time keep their old baseline */
+        for (int k = 0; k < nres; ++k) {
+            result_t* b = (result_t*) find_result(base, nbase, res[k].name);
+            if (b) *b = res[k];
+            else if (nbase < MAX_KERNELS) base[nbase++] = res[k];
+        }
+        if (save_baseline(baseline_path, base, nbase) != 0) { perror("bench: baseline"); return 2; }
+        printf("baseline written to %s\n", baseline_path);
+    }
+    return failed ? 2 : regressed;
+}
@@ -0,0 +1,9173 @@
+.intel_syntax noprefix
+.section .data
+v_0:
+    .quad 0
+v_1:
+    .quad 0
+v_2:
+    .quad 0
+v_3:
+    .quad 0
+.section .text
+.global _start
+_start:
+    lfence
+    rdtsc
+    shl rdx, 32
+    or rax, rdx
+    mov qword ptr [rip + lsys_bench_tsc], rax
+    mov rax, 1
+    mov qword ptr [rip + v_0], rax
+    mov rax, 2
+    mov qword ptr [rip + v_1], rax
+    mov rax, 3
+    mov qword ptr [rip + v_2], rax
+    mov rax, 4
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 1
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 6
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 4
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 6
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 8
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 1
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 8
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 4
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 7
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 4
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 5
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 1
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 7
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 2
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 9
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 3
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 1
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 8
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 1
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 8
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 1
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 9
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 4
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 1
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 6
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 5
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 4
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 8
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 4
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 5
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 5
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 2
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 1
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 2
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 1
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 4
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 2
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 7
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 1
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 9
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 3
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 1
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 7
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 1
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 7
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 5
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 4
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 1
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 5
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 6
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 3
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 8
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 1
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 8
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 3
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 9
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 8
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 1
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 4
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 3
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 9
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 8
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 1
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 3
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 7
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 6
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 1
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 1
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 2
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 9
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 9
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 1
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 3
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 1
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 9
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 5
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 7
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 5
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 5
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 6
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 8
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 8
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 8
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 1
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 2
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 7
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 9
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 9
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 1
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 8
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 8
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 1
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 6
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 1
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 5
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 4
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 9
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 8
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 3
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 3
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 7
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 5
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 1
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 5
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 1
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 2
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 6
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 1
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 4
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 2
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 9
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 1
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 1
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 2
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 1
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 8
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 8
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 1
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 3
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 4
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 7
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 3
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 1
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 8
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 1
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 8
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 2
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 1
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 6
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 2
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 1
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 6
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 6
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 9
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 1
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 3
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 5
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 1
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 2
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 1
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 6
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 7
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 2
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 7
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 1
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 7
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 5
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 1
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 1
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 1
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 1
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 1
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 1
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 3
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 1
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 6
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 3
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 3
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 2
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 5
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 8
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 8
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 1
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 1
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 2
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 4
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 7
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 8
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 9
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 7
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 4
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 8
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 9
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 9
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 6
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 4
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 1
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 1
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 2
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 1
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 8
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 3
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 3
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 9
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 5
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 1
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 1
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 6
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 4
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 9
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 7
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 1
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 6
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 6
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 2
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 1
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 1
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 7
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 1
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, 2
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 1
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    lfence
+    rdtsc
+    shl rdx, 32
+    or rax, rdx
+    sub rax, qword ptr [rip + lsys_bench_tsc]
+    mov qword ptr [rip + lsys_bench_tsc], rax
+    mov rax, 1
+    mov rdi, 3
+    lea rsi, [rip + lsys_bench_tsc]
+    mov rdx, 8
+    syscall
+    mov rax, 60
+    xor rdi, rdi
+    syscall
+.section .data
+lsys_bench_tsc:
+    .quad 0
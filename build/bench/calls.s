@@ -0,0 +1,7724 @@
+.intel_syntax noprefix
+.section .data
+v_0:
+    .quad 0
+v_1:
+    .quad 0
+v_2:
+    .quad 0
+v_3:
+    .quad 0
+.section .text
+.global _start
+_start:
+    lfence
+    rdtsc
+    shl rdx, 32
+    or rax, rdx
+    mov qword ptr [rip + lsys_bench_tsc], rax
+    mov rax, 2
+    mov qword ptr [rip + v_0], rax
+    mov rax, 3
+    mov qword ptr [rip + v_1], rax
+    mov rax, 4
+    mov qword ptr [rip + v_2], rax
+    mov rax, 5
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r9
+    pop r8
+    pop rsi
+    pop rdi
+    call f_wide
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop r8
+    pop rsi
+    pop rdi
+    call f_acc
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    pop rdi
+    call f_outer
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_3], rax
+    lfence
+    rdtsc
+    shl rdx, 32
+    or rax, rdx
+    sub rax, qword ptr [rip + lsys_bench_tsc]
+    mov qword ptr [rip + lsys_bench_tsc], rax
+    mov rax, 1
+    mov rdi, 3
+    lea rsi, [rip + lsys_bench_tsc]
+    mov rdx, 8
+    syscall
+    mov rax, 60
+    xor rdi, rdi
+    syscall
+f_sq:
+    mov rax, rdi
+    push rax
+    mov rax, rdi
+    pop rbx
+    imul rax, rbx
+.Lret_sq:
+    ret
+f_mix:
+    mov rax, rdi
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, rsi
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+.Lret_mix:
+    ret
+f_acc:
+    xor r9, r9
+    xor r10, r10
+    mov rax, rdi
+    push rax
+    mov rax, rsi
+    pop rbx
+    add rax, rbx
+    mov r9, rax
+    mov rax, r9
+    push rax
+    mov rax, r8
+    pop rbx
+    imul rax, rbx
+    mov r9, rax
+    mov rax, r9
+    push rax
+    mov rax, rdi
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov r10, rax
+    mov rax, r10
+    push rax
+    mov rax, rsi
+    push rax
+    mov rax, rsi
+    pop rbx
+    imul rax, rbx
+    pop rbx
+    add rax, rbx
+.Lret_acc:
+    ret
+f_wide:
+    push rbp
+    mov rbp, rsp
+    sub rsp, 80
+    mov qword ptr [rbp - 8], rdi
+    mov qword ptr [rbp - 16], rsi
+    mov qword ptr [rbp - 24], r8
+    mov qword ptr [rbp - 32], r9
+    mov qword ptr [rbp - 40], 0
+    mov qword ptr [rbp - 48], 0
+    mov qword ptr [rbp - 56], 0
+    mov qword ptr [rbp - 64], 0
+    mov qword ptr [rbp - 72], 0
+    mov qword ptr [rbp - 80], 0
+    mov rax, qword ptr [rbp - 8]
+    push rax
+    mov rax, qword ptr [rbp - 16]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rbp - 40], rax
+    mov rax, qword ptr [rbp - 24]
+    push rax
+    mov rax, qword ptr [rbp - 32]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rbp - 48], rax
+    mov rax, qword ptr [rbp - 40]
+    push rax
+    mov rax, qword ptr [rbp - 48]
+    pop rbx
+    imul rax, rbx
+    mov qword ptr [rbp - 56], rax
+    mov rax, qword ptr [rbp - 56]
+    push rax
+    mov rax, qword ptr [rbp - 8]
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rbp - 64], rax
+    mov rax, qword ptr [rbp - 64]
+    push rax
+    mov rax, qword ptr [rbp - 16]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rbp - 72], rax
+    mov rax, qword ptr [rbp - 72]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    mov qword ptr [rbp - 80], rax
+    mov rax, qword ptr [rbp - 80]
+    push rax
+    mov rax, qword ptr [rbp - 24]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, qword ptr [rbp - 32]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    pop rbx
+    add rax, rbx
+.Lret_wide:
+    leave
+    ret
+f_shadow:
+    mov rax, rdi
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, rsi
+    pop rbx
+    add rax, rbx
+.Lret_shadow:
+    ret
+f_outer:
+    mov rax, rdi
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, rdi
+    pop rbx
+    add rax, rbx
+.Lret_outer:
+    ret
+.section .data
+lsys_bench_tsc:
+    .quad 0
@@ -0,0 +1,8971 @@
+.intel_syntax noprefix
+.section .data
+v_0:
+    .quad 0
+v_1:
+    .quad 0
+v_2:
+    .quad 0
+.section .text
+.global _start
+_start:
+    lfence
+    rdtsc
+    shl rdx, 32
+    or rax, rdx
+    mov qword ptr [rip + lsys_bench_tsc], rax
+    mov rax, 1000003
+    mov qword ptr [rip + v_0], rax
+    mov rax, 77777
+    mov qword ptr [rip + v_1], rax
+    mov rax, 31337
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 612
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 10
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 13
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 10
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 10
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 620
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 308
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 520
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 544
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 129
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 660
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 731
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 105
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 13
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 267
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 516
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 977
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 833
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 11
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 11
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 11
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 12
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 184
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 927
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 910
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 474
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 981
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 13
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 249
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 580
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 11
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 13
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 814
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 13
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 194
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 549
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 525
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 124
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 12
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 240
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 10
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 353
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 771
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 186
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 167
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 723
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 13
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 462
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 745
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 263
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 12
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 10
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 360
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 11
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 571
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 485
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 10
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 12
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 289
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 812
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 636
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 11
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 612
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 758
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 12
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 892
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 588
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 500
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 340
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 12
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 498
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 107
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 11
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 678
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 11
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 10
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 204
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 404
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 130
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 12
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 933
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 266
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 212
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 199
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 13
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 388
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 882
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 11
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 484
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 289
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 325
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 772
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 236
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 254
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 404
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 463
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 836
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 12
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 313
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 561
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 999
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 553
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 919
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 479
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 371
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 356
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 348
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 334
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 13
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 407
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 10
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 13
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 500
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 542
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 316
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 277
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 395
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 540
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 10
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 10
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 11
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 767
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 11
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 230
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 11
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 723
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 660
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 685
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 387
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 579
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 701
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 511
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 370
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 12
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 314
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 12
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 178
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 389
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 10
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 10
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 603
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 528
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 894
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 163
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 987
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 867
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 909
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 13
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 535
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 607
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 382
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 292
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 12
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 530
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 863
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 280
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 12
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 634
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 953
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 201
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 230
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 368
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 222
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 371
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 12
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 482
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 175
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 840
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 464
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 13
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 732
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 161
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 798
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 12
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 387
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 161
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 945
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 531
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 892
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 636
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 585
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 379
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 12
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 988
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 585
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 503
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 10
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 637
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 13
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 691
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 10
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 13
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 10
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 11
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 144
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 673
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 11
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 455
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 12
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 315
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 12
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 799
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 11
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 660
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 880
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 13
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 945
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 573
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 10
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 12
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 283
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 10
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 707
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 11
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 13
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 142
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 383
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 892
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 561
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 702
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 580
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 924
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 367
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 191
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 662
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 477
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 12
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 12
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 889
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 11
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 318
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 328
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 539
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 783
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 791
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 405
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 458
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 973
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 262
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 504
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 421
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 204
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 861
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 253
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 842
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 863
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 515
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 265
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 600
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 13
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 420
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 813
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 330
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 12
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 13
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 10
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 160
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 11
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 875
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 400
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 406
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 892
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 11
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 11
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 587
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 10
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 12
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 916
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 655
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 820
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 411
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 912
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 224
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 975
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 959
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 456
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 242
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 141
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 517
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 13
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 480
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 562
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 378
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 853
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 584
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 10
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 724
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 134
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 10
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 721
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 926
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 582
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 278
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 12
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 965
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 811
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 838
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 289
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 861
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 307
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 11
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 469
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 360
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 12
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 844
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 457
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 502
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 848
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 867
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 341
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 726
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 11
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 175
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 215
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 735
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 143
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 12
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 841
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 906
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 532
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 828
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 346
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 205
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 995
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 147
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 13
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 861
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 198
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 190
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 734
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 572
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 261
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 793
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 10
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 11
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 403
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 10
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 915
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 10
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 227
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 493
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 447
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 695
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 899
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 391
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 348
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 13
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 11
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 12
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 772
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 983
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 985
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 230
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 349
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 734
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 946
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 10
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 13
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 196
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 772
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 159
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 640
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 106
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 221
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 13
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 10
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 555
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 233
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 9
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 117
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 886
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 788
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 879
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 649
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 993
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 13
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 6
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 176
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 7
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 213
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 2
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 816
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 8
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 177
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 3
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 306
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, 13
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 11
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 4
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 825
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, 5
+    pop rbx
+    imul rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, 900
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, 10
+    pop rbx
+    mov rcx, rax
+    mov rax, rbx
+    cqo
+    idiv rcx
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    mov qword ptr [rip + v_0], rax
+    lfence
+    rdtsc
+    shl rdx, 32
+    or rax, rdx
+    sub rax, qword ptr [rip + lsys_bench_tsc]
+    mov qword ptr [rip + lsys_bench_tsc], rax
+    mov rax, 1
+    mov rdi, 3
+    lea rsi, [rip + lsys_bench_tsc]
+    mov rdx, 8
+    syscall
+    mov rax, 60
+    xor rdi, rdi
+    syscall
+.section .data
+lsys_bench_tsc:
+    .quad 0
@@ -0,0 +1,31 @@
+.intel_syntax noprefix
+.section .data
+v_0:
+    .quad 0
+.section .text
+.global _start
+_start:
+    lfence
+    rdtsc
+    shl rdx, 32
+    or rax, rdx
+    mov qword ptr [rip + lsys_bench_tsc], rax
+    mov rax, 0
+    mov qword ptr [rip + v_0], rax
+    lfence
+    rdtsc
+    shl rdx, 32
+    or rax, rdx
+    sub rax, qword ptr [rip + lsys_bench_tsc]
+    mov qword ptr [rip + lsys_bench_tsc], rax
+    mov rax, 1
+    mov rdi, 3
+    lea rsi, [rip + lsys_bench_tsc]
+    mov rdx, 8
+    syscall
+    mov rax, 60
+    xor rdi, rdi
+    syscall
+.section .data
+lsys_bench_tsc:
+    .quad 0
@@ -0,0 +1,10011 @@
+.intel_syntax noprefix
+.section .data
+v_0:
+    .quad 0
+v_1:
+    .quad 0
+v_2:
+    .quad 0
+v_3:
+    .quad 0
+v_4:
+    .quad 0
+v_5:
+    .quad 0
+v_6:
+    .quad 0
+v_7:
+    .quad 0
+v_8:
+    .quad 0
+v_9:
+    .quad 0
+v_10:
+    .quad 0
+v_11:
+    .quad 0
+v_12:
+    .quad 0
+v_13:
+    .quad 0
+v_14:
+    .quad 0
+v_15:
+    .quad 0
+v_16:
+    .quad 0
+v_17:
+    .quad 0
+v_18:
+    .quad 0
+v_19:
+    .quad 0
+v_20:
+    .quad 0
+v_21:
+    .quad 0
+v_22:
+    .quad 0
+v_23:
+    .quad 0
+v_24:
+    .quad 0
+v_25:
+    .quad 0
+v_26:
+    .quad 0
+v_27:
+    .quad 0
+v_28:
+    .quad 0
+v_29:
+    .quad 0
+v_30:
+    .quad 0
+v_31:
+    .quad 0
+v_32:
+    .quad 0
+v_33:
+    .quad 0
+v_34:
+    .quad 0
+v_35:
+    .quad 0
+v_36:
+    .quad 0
+v_37:
+    .quad 0
+v_38:
+    .quad 0
+v_39:
+    .quad 0
+v_40:
+    .quad 0
+v_41:
+    .quad 0
+v_42:
+    .quad 0
+v_43:
+    .quad 0
+v_44:
+    .quad 0
+v_45:
+    .quad 0
+v_46:
+    .quad 0
+v_47:
+    .quad 0
+v_48:
+    .quad 0
+v_49:
+    .quad 0
+v_50:
+    .quad 0
+v_51:
+    .quad 0
+v_52:
+    .quad 0
+v_53:
+    .quad 0
+v_54:
+    .quad 0
+v_55:
+    .quad 0
+v_56:
+    .quad 0
+v_57:
+    .quad 0
+v_58:
+    .quad 0
+v_59:
+    .quad 0
+v_60:
+    .quad 0
+v_61:
+    .quad 0
+v_62:
+    .quad 0
+v_63:
+    .quad 0
+v_64:
+    .quad 0
+v_65:
+    .quad 0
+v_66:
+    .quad 0
+v_67:
+    .quad 0
+v_68:
+    .quad 0
+v_69:
+    .quad 0
+v_70:
+    .quad 0
+v_71:
+    .quad 0
+v_72:
+    .quad 0
+v_73:
+    .quad 0
+v_74:
+    .quad 0
+v_75:
+    .quad 0
+v_76:
+    .quad 0
+v_77:
+    .quad 0
+v_78:
+    .quad 0
+v_79:
+    .quad 0
+v_80:
+    .quad 0
+v_81:
+    .quad 0
+v_82:
+    .quad 0
+v_83:
+    .quad 0
+v_84:
+    .quad 0
+v_85:
+    .quad 0
+v_86:
+    .quad 0
+v_87:
+    .quad 0
+v_88:
+    .quad 0
+v_89:
+    .quad 0
+v_90:
+    .quad 0
+v_91:
+    .quad 0
+v_92:
+    .quad 0
+v_93:
+    .quad 0
+v_94:
+    .quad 0
+v_95:
+    .quad 0
+.section .text
+.global _start
+_start:
+    lfence
+    rdtsc
+    shl rdx, 32
+    or rax, rdx
+    mov qword ptr [rip + lsys_bench_tsc], rax
+    mov rax, 0
+    mov qword ptr [rip + v_0], rax
+    mov rax, 1
+    mov qword ptr [rip + v_1], rax
+    mov rax, 2
+    mov qword ptr [rip + v_2], rax
+    mov rax, 3
+    mov qword ptr [rip + v_3], rax
+    mov rax, 4
+    mov qword ptr [rip + v_4], rax
+    mov rax, 5
+    mov qword ptr [rip + v_5], rax
+    mov rax, 6
+    mov qword ptr [rip + v_6], rax
+    mov rax, 7
+    mov qword ptr [rip + v_7], rax
+    mov rax, 8
+    mov qword ptr [rip + v_8], rax
+    mov rax, 9
+    mov qword ptr [rip + v_9], rax
+    mov rax, 10
+    mov qword ptr [rip + v_10], rax
+    mov rax, 11
+    mov qword ptr [rip + v_11], rax
+    mov rax, 12
+    mov qword ptr [rip + v_12], rax
+    mov rax, 13
+    mov qword ptr [rip + v_13], rax
+    mov rax, 14
+    mov qword ptr [rip + v_14], rax
+    mov rax, 15
+    mov qword ptr [rip + v_15], rax
+    mov rax, 16
+    mov qword ptr [rip + v_16], rax
+    mov rax, 17
+    mov qword ptr [rip + v_17], rax
+    mov rax, 18
+    mov qword ptr [rip + v_18], rax
+    mov rax, 19
+    mov qword ptr [rip + v_19], rax
+    mov rax, 20
+    mov qword ptr [rip + v_20], rax
+    mov rax, 21
+    mov qword ptr [rip + v_21], rax
+    mov rax, 22
+    mov qword ptr [rip + v_22], rax
+    mov rax, 23
+    mov qword ptr [rip + v_23], rax
+    mov rax, 24
+    mov qword ptr [rip + v_24], rax
+    mov rax, 25
+    mov qword ptr [rip + v_25], rax
+    mov rax, 26
+    mov qword ptr [rip + v_26], rax
+    mov rax, 27
+    mov qword ptr [rip + v_27], rax
+    mov rax, 28
+    mov qword ptr [rip + v_28], rax
+    mov rax, 29
+    mov qword ptr [rip + v_29], rax
+    mov rax, 30
+    mov qword ptr [rip + v_30], rax
+    mov rax, 31
+    mov qword ptr [rip + v_31], rax
+    mov rax, 32
+    mov qword ptr [rip + v_32], rax
+    mov rax, 33
+    mov qword ptr [rip + v_33], rax
+    mov rax, 34
+    mov qword ptr [rip + v_34], rax
+    mov rax, 35
+    mov qword ptr [rip + v_35], rax
+    mov rax, 36
+    mov qword ptr [rip + v_36], rax
+    mov rax, 37
+    mov qword ptr [rip + v_37], rax
+    mov rax, 38
+    mov qword ptr [rip + v_38], rax
+    mov rax, 39
+    mov qword ptr [rip + v_39], rax
+    mov rax, 40
+    mov qword ptr [rip + v_40], rax
+    mov rax, 41
+    mov qword ptr [rip + v_41], rax
+    mov rax, 42
+    mov qword ptr [rip + v_42], rax
+    mov rax, 43
+    mov qword ptr [rip + v_43], rax
+    mov rax, 44
+    mov qword ptr [rip + v_44], rax
+    mov rax, 45
+    mov qword ptr [rip + v_45], rax
+    mov rax, 46
+    mov qword ptr [rip + v_46], rax
+    mov rax, 47
+    mov qword ptr [rip + v_47], rax
+    mov rax, 48
+    mov qword ptr [rip + v_48], rax
+    mov rax, 49
+    mov qword ptr [rip + v_49], rax
+    mov rax, 50
+    mov qword ptr [rip + v_50], rax
+    mov rax, 51
+    mov qword ptr [rip + v_51], rax
+    mov rax, 52
+    mov qword ptr [rip + v_52], rax
+    mov rax, 53
+    mov qword ptr [rip + v_53], rax
+    mov rax, 54
+    mov qword ptr [rip + v_54], rax
+    mov rax, 55
+    mov qword ptr [rip + v_55], rax
+    mov rax, 56
+    mov qword ptr [rip + v_56], rax
+    mov rax, 57
+    mov qword ptr [rip + v_57], rax
+    mov rax, 58
+    mov qword ptr [rip + v_58], rax
+    mov rax, 59
+    mov qword ptr [rip + v_59], rax
+    mov rax, 60
+    mov qword ptr [rip + v_60], rax
+    mov rax, 61
+    mov qword ptr [rip + v_61], rax
+    mov rax, 62
+    mov qword ptr [rip + v_62], rax
+    mov rax, 63
+    mov qword ptr [rip + v_63], rax
+    mov rax, 64
+    mov qword ptr [rip + v_64], rax
+    mov rax, 65
+    mov qword ptr [rip + v_65], rax
+    mov rax, 66
+    mov qword ptr [rip + v_66], rax
+    mov rax, 67
+    mov qword ptr [rip + v_67], rax
+    mov rax, 68
+    mov qword ptr [rip + v_68], rax
+    mov rax, 69
+    mov qword ptr [rip + v_69], rax
+    mov rax, 70
+    mov qword ptr [rip + v_70], rax
+    mov rax, 71
+    mov qword ptr [rip + v_71], rax
+    mov rax, 72
+    mov qword ptr [rip + v_72], rax
+    mov rax, 73
+    mov qword ptr [rip + v_73], rax
+    mov rax, 74
+    mov qword ptr [rip + v_74], rax
+    mov rax, 75
+    mov qword ptr [rip + v_75], rax
+    mov rax, 76
+    mov qword ptr [rip + v_76], rax
+    mov rax, 77
+    mov qword ptr [rip + v_77], rax
+    mov rax, 78
+    mov qword ptr [rip + v_78], rax
+    mov rax, 79
+    mov qword ptr [rip + v_79], rax
+    mov rax, 80
+    mov qword ptr [rip + v_80], rax
+    mov rax, 81
+    mov qword ptr [rip + v_81], rax
+    mov rax, 82
+    mov qword ptr [rip + v_82], rax
+    mov rax, 83
+    mov qword ptr [rip + v_83], rax
+    mov rax, 84
+    mov qword ptr [rip + v_84], rax
+    mov rax, 85
+    mov qword ptr [rip + v_85], rax
+    mov rax, 86
+    mov qword ptr [rip + v_86], rax
+    mov rax, 87
+    mov qword ptr [rip + v_87], rax
+    mov rax, 88
+    mov qword ptr [rip + v_88], rax
+    mov rax, 89
+    mov qword ptr [rip + v_89], rax
+    mov rax, 90
+    mov qword ptr [rip + v_90], rax
+    mov rax, 91
+    mov qword ptr [rip + v_91], rax
+    mov rax, 92
+    mov qword ptr [rip + v_92], rax
+    mov rax, 93
+    mov qword ptr [rip + v_93], rax
+    mov rax, 94
+    mov qword ptr [rip + v_94], rax
+    mov rax, 95
+    mov qword ptr [rip + v_95], rax
+    mov rax, qword ptr [rip + v_8]
+    push rax
+    mov rax, qword ptr [rip + v_62]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_5], rax
+    mov rax, qword ptr [rip + v_25]
+    push rax
+    mov rax, qword ptr [rip + v_45]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_17], rax
+    mov rax, qword ptr [rip + v_47]
+    push rax
+    mov rax, qword ptr [rip + v_71]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_49], rax
+    mov rax, qword ptr [rip + v_11]
+    push rax
+    mov rax, qword ptr [rip + v_74]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_89], rax
+    mov rax, qword ptr [rip + v_84]
+    push rax
+    mov rax, qword ptr [rip + v_59]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_95], rax
+    mov rax, qword ptr [rip + v_81]
+    push rax
+    mov rax, qword ptr [rip + v_42]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_32], rax
+    mov rax, qword ptr [rip + v_73]
+    push rax
+    mov rax, qword ptr [rip + v_48]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_86]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_80], rax
+    mov rax, qword ptr [rip + v_58]
+    push rax
+    mov rax, qword ptr [rip + v_22]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_27], rax
+    mov rax, qword ptr [rip + v_47]
+    push rax
+    mov rax, qword ptr [rip + v_84]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_4], rax
+    mov rax, qword ptr [rip + v_24]
+    push rax
+    mov rax, qword ptr [rip + v_83]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_6], rax
+    mov rax, qword ptr [rip + v_85]
+    push rax
+    mov rax, qword ptr [rip + v_12]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_63], rax
+    mov rax, qword ptr [rip + v_71]
+    push rax
+    mov rax, qword ptr [rip + v_52]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_95], rax
+    mov rax, qword ptr [rip + v_92]
+    push rax
+    mov rax, qword ptr [rip + v_7]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_33], rax
+    mov rax, qword ptr [rip + v_38]
+    push rax
+    mov rax, qword ptr [rip + v_28]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_21], rax
+    mov rax, qword ptr [rip + v_58]
+    push rax
+    mov rax, qword ptr [rip + v_82]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_4], rax
+    mov rax, qword ptr [rip + v_20]
+    push rax
+    mov rax, qword ptr [rip + v_21]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_48], rax
+    mov rax, qword ptr [rip + v_80]
+    push rax
+    mov rax, qword ptr [rip + v_36]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_55], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_70]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_82], rax
+    mov rax, qword ptr [rip + v_47]
+    push rax
+    mov rax, qword ptr [rip + v_62]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_76], rax
+    mov rax, qword ptr [rip + v_5]
+    push rax
+    mov rax, qword ptr [rip + v_47]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_29], rax
+    mov rax, qword ptr [rip + v_11]
+    push rax
+    mov rax, qword ptr [rip + v_40]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_13], rax
+    mov rax, qword ptr [rip + v_12]
+    push rax
+    mov rax, qword ptr [rip + v_87]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_9], rax
+    mov rax, qword ptr [rip + v_45]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_54], rax
+    mov rax, qword ptr [rip + v_21]
+    push rax
+    mov rax, qword ptr [rip + v_77]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_50], rax
+    mov rax, qword ptr [rip + v_34]
+    push rax
+    mov rax, qword ptr [rip + v_49]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_29], rax
+    mov rax, qword ptr [rip + v_77]
+    push rax
+    mov rax, qword ptr [rip + v_5]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_74], rax
+    mov rax, qword ptr [rip + v_11]
+    push rax
+    mov rax, qword ptr [rip + v_52]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_14], rax
+    mov rax, qword ptr [rip + v_58]
+    push rax
+    mov rax, qword ptr [rip + v_57]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_66], rax
+    mov rax, qword ptr [rip + v_52]
+    push rax
+    mov rax, qword ptr [rip + v_10]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_29], rax
+    mov rax, qword ptr [rip + v_92]
+    push rax
+    mov rax, qword ptr [rip + v_31]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_86], rax
+    mov rax, qword ptr [rip + v_5]
+    push rax
+    mov rax, qword ptr [rip + v_58]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_66]
+    push rax
+    mov rax, qword ptr [rip + v_12]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_84]
+    push rax
+    mov rax, qword ptr [rip + v_44]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_78], rax
+    mov rax, qword ptr [rip + v_50]
+    push rax
+    mov rax, qword ptr [rip + v_69]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_72], rax
+    mov rax, qword ptr [rip + v_85]
+    push rax
+    mov rax, qword ptr [rip + v_54]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_10], rax
+    mov rax, qword ptr [rip + v_47]
+    push rax
+    mov rax, qword ptr [rip + v_94]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_29], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_69]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_36], rax
+    mov rax, qword ptr [rip + v_59]
+    push rax
+    mov rax, qword ptr [rip + v_22]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_5], rax
+    mov rax, qword ptr [rip + v_78]
+    push rax
+    mov rax, qword ptr [rip + v_75]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_52], rax
+    mov rax, qword ptr [rip + v_42]
+    push rax
+    mov rax, qword ptr [rip + v_49]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_10], rax
+    mov rax, qword ptr [rip + v_40]
+    push rax
+    mov rax, qword ptr [rip + v_67]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_25], rax
+    mov rax, qword ptr [rip + v_10]
+    push rax
+    mov rax, qword ptr [rip + v_86]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_55], rax
+    mov rax, qword ptr [rip + v_83]
+    push rax
+    mov rax, qword ptr [rip + v_33]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_17], rax
+    mov rax, qword ptr [rip + v_87]
+    push rax
+    mov rax, qword ptr [rip + v_25]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_79], rax
+    mov rax, qword ptr [rip + v_59]
+    push rax
+    mov rax, qword ptr [rip + v_87]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_81], rax
+    mov rax, qword ptr [rip + v_89]
+    push rax
+    mov rax, qword ptr [rip + v_29]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_80], rax
+    mov rax, qword ptr [rip + v_78]
+    push rax
+    mov rax, qword ptr [rip + v_31]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_83], rax
+    mov rax, qword ptr [rip + v_70]
+    push rax
+    mov rax, qword ptr [rip + v_83]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_64], rax
+    mov rax, qword ptr [rip + v_30]
+    push rax
+    mov rax, qword ptr [rip + v_45]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_92], rax
+    mov rax, qword ptr [rip + v_71]
+    push rax
+    mov rax, qword ptr [rip + v_95]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_66], rax
+    mov rax, qword ptr [rip + v_94]
+    push rax
+    mov rax, qword ptr [rip + v_21]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_7], rax
+    mov rax, qword ptr [rip + v_74]
+    push rax
+    mov rax, qword ptr [rip + v_31]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_63], rax
+    mov rax, qword ptr [rip + v_29]
+    push rax
+    mov rax, qword ptr [rip + v_67]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_62], rax
+    mov rax, qword ptr [rip + v_7]
+    push rax
+    mov rax, qword ptr [rip + v_91]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_27], rax
+    mov rax, qword ptr [rip + v_24]
+    push rax
+    mov rax, qword ptr [rip + v_41]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_88], rax
+    mov rax, qword ptr [rip + v_51]
+    push rax
+    mov rax, qword ptr [rip + v_43]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_12], rax
+    mov rax, qword ptr [rip + v_23]
+    push rax
+    mov rax, qword ptr [rip + v_60]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_56], rax
+    mov rax, qword ptr [rip + v_13]
+    push rax
+    mov rax, qword ptr [rip + v_85]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_81], rax
+    mov rax, qword ptr [rip + v_21]
+    push rax
+    mov rax, qword ptr [rip + v_64]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_73], rax
+    mov rax, qword ptr [rip + v_4]
+    push rax
+    mov rax, qword ptr [rip + v_20]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_30], rax
+    mov rax, qword ptr [rip + v_64]
+    push rax
+    mov rax, qword ptr [rip + v_81]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_52], rax
+    mov rax, qword ptr [rip + v_54]
+    push rax
+    mov rax, qword ptr [rip + v_63]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_62], rax
+    mov rax, qword ptr [rip + v_85]
+    push rax
+    mov rax, qword ptr [rip + v_92]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_23], rax
+    mov rax, qword ptr [rip + v_15]
+    push rax
+    mov rax, qword ptr [rip + v_33]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_14], rax
+    mov rax, qword ptr [rip + v_69]
+    push rax
+    mov rax, qword ptr [rip + v_67]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_23], rax
+    mov rax, qword ptr [rip + v_16]
+    push rax
+    mov rax, qword ptr [rip + v_15]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_72], rax
+    mov rax, qword ptr [rip + v_42]
+    push rax
+    mov rax, qword ptr [rip + v_36]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_54], rax
+    mov rax, qword ptr [rip + v_66]
+    push rax
+    mov rax, qword ptr [rip + v_14]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_15], rax
+    mov rax, qword ptr [rip + v_53]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_26], rax
+    mov rax, qword ptr [rip + v_42]
+    push rax
+    mov rax, qword ptr [rip + v_42]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_21], rax
+    mov rax, qword ptr [rip + v_15]
+    push rax
+    mov rax, qword ptr [rip + v_63]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_93], rax
+    mov rax, qword ptr [rip + v_93]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_10], rax
+    mov rax, qword ptr [rip + v_35]
+    push rax
+    mov rax, qword ptr [rip + v_52]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_22], rax
+    mov rax, qword ptr [rip + v_62]
+    push rax
+    mov rax, qword ptr [rip + v_73]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_80], rax
+    mov rax, qword ptr [rip + v_67]
+    push rax
+    mov rax, qword ptr [rip + v_9]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_16], rax
+    mov rax, qword ptr [rip + v_32]
+    push rax
+    mov rax, qword ptr [rip + v_72]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_46], rax
+    mov rax, qword ptr [rip + v_34]
+    push rax
+    mov rax, qword ptr [rip + v_73]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_91], rax
+    mov rax, qword ptr [rip + v_21]
+    push rax
+    mov rax, qword ptr [rip + v_81]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_92], rax
+    mov rax, qword ptr [rip + v_73]
+    push rax
+    mov rax, qword ptr [rip + v_86]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_81], rax
+    mov rax, qword ptr [rip + v_28]
+    push rax
+    mov rax, qword ptr [rip + v_11]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_82], rax
+    mov rax, qword ptr [rip + v_37]
+    push rax
+    mov rax, qword ptr [rip + v_67]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_91], rax
+    mov rax, qword ptr [rip + v_14]
+    push rax
+    mov rax, qword ptr [rip + v_16]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_88], rax
+    mov rax, qword ptr [rip + v_21]
+    push rax
+    mov rax, qword ptr [rip + v_81]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_6], rax
+    mov rax, qword ptr [rip + v_70]
+    push rax
+    mov rax, qword ptr [rip + v_18]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_52], rax
+    mov rax, qword ptr [rip + v_63]
+    push rax
+    mov rax, qword ptr [rip + v_80]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_7], rax
+    mov rax, qword ptr [rip + v_66]
+    push rax
+    mov rax, qword ptr [rip + v_40]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_12], rax
+    mov rax, qword ptr [rip + v_95]
+    push rax
+    mov rax, qword ptr [rip + v_17]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_47]
+    push rax
+    mov rax, qword ptr [rip + v_62]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_59], rax
+    mov rax, qword ptr [rip + v_26]
+    push rax
+    mov rax, qword ptr [rip + v_14]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_80], rax
+    mov rax, qword ptr [rip + v_26]
+    push rax
+    mov rax, qword ptr [rip + v_60]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_35], rax
+    mov rax, qword ptr [rip + v_47]
+    push rax
+    mov rax, qword ptr [rip + v_78]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_11], rax
+    mov rax, qword ptr [rip + v_59]
+    push rax
+    mov rax, qword ptr [rip + v_57]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_83], rax
+    mov rax, qword ptr [rip + v_95]
+    push rax
+    mov rax, qword ptr [rip + v_48]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_87], rax
+    mov rax, qword ptr [rip + v_12]
+    push rax
+    mov rax, qword ptr [rip + v_24]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_38], rax
+    mov rax, qword ptr [rip + v_18]
+    push rax
+    mov rax, qword ptr [rip + v_85]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_83], rax
+    mov rax, qword ptr [rip + v_91]
+    push rax
+    mov rax, qword ptr [rip + v_28]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_43], rax
+    mov rax, qword ptr [rip + v_29]
+    push rax
+    mov rax, qword ptr [rip + v_92]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_48], rax
+    mov rax, qword ptr [rip + v_93]
+    push rax
+    mov rax, qword ptr [rip + v_69]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_82], rax
+    mov rax, qword ptr [rip + v_20]
+    push rax
+    mov rax, qword ptr [rip + v_4]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_24], rax
+    mov rax, qword ptr [rip + v_33]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_12], rax
+    mov rax, qword ptr [rip + v_47]
+    push rax
+    mov rax, qword ptr [rip + v_69]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_89], rax
+    mov rax, qword ptr [rip + v_30]
+    push rax
+    mov rax, qword ptr [rip + v_56]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_22], rax
+    mov rax, qword ptr [rip + v_8]
+    push rax
+    mov rax, qword ptr [rip + v_47]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_35], rax
+    mov rax, qword ptr [rip + v_49]
+    push rax
+    mov rax, qword ptr [rip + v_92]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_25], rax
+    mov rax, qword ptr [rip + v_42]
+    push rax
+    mov rax, qword ptr [rip + v_13]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_42], rax
+    mov rax, qword ptr [rip + v_83]
+    push rax
+    mov rax, qword ptr [rip + v_48]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_42], rax
+    mov rax, qword ptr [rip + v_33]
+    push rax
+    mov rax, qword ptr [rip + v_94]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_27], rax
+    mov rax, qword ptr [rip + v_44]
+    push rax
+    mov rax, qword ptr [rip + v_88]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_88], rax
+    mov rax, qword ptr [rip + v_76]
+    push rax
+    mov rax, qword ptr [rip + v_11]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_63], rax
+    mov rax, qword ptr [rip + v_56]
+    push rax
+    mov rax, qword ptr [rip + v_44]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_27], rax
+    mov rax, qword ptr [rip + v_5]
+    push rax
+    mov rax, qword ptr [rip + v_6]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_81], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_92]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_91]
+    push rax
+    mov rax, qword ptr [rip + v_48]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_31], rax
+    mov rax, qword ptr [rip + v_53]
+    push rax
+    mov rax, qword ptr [rip + v_80]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_53], rax
+    mov rax, qword ptr [rip + v_76]
+    push rax
+    mov rax, qword ptr [rip + v_95]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_81], rax
+    mov rax, qword ptr [rip + v_19]
+    push rax
+    mov rax, qword ptr [rip + v_26]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_47], rax
+    mov rax, qword ptr [rip + v_19]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_26], rax
+    mov rax, qword ptr [rip + v_62]
+    push rax
+    mov rax, qword ptr [rip + v_7]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_34], rax
+    mov rax, qword ptr [rip + v_23]
+    push rax
+    mov rax, qword ptr [rip + v_5]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_25], rax
+    mov rax, qword ptr [rip + v_14]
+    push rax
+    mov rax, qword ptr [rip + v_26]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_84], rax
+    mov rax, qword ptr [rip + v_28]
+    push rax
+    mov rax, qword ptr [rip + v_17]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_17], rax
+    mov rax, qword ptr [rip + v_46]
+    push rax
+    mov rax, qword ptr [rip + v_64]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_10], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_38]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_46], rax
+    mov rax, qword ptr [rip + v_14]
+    push rax
+    mov rax, qword ptr [rip + v_68]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_56], rax
+    mov rax, qword ptr [rip + v_63]
+    push rax
+    mov rax, qword ptr [rip + v_50]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_39], rax
+    mov rax, qword ptr [rip + v_24]
+    push rax
+    mov rax, qword ptr [rip + v_28]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_41], rax
+    mov rax, qword ptr [rip + v_74]
+    push rax
+    mov rax, qword ptr [rip + v_21]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_50], rax
+    mov rax, qword ptr [rip + v_69]
+    push rax
+    mov rax, qword ptr [rip + v_45]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_65], rax
+    mov rax, qword ptr [rip + v_82]
+    push rax
+    mov rax, qword ptr [rip + v_20]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_29], rax
+    mov rax, qword ptr [rip + v_35]
+    push rax
+    mov rax, qword ptr [rip + v_74]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_46], rax
+    mov rax, qword ptr [rip + v_19]
+    push rax
+    mov rax, qword ptr [rip + v_61]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_17], rax
+    mov rax, qword ptr [rip + v_7]
+    push rax
+    mov rax, qword ptr [rip + v_45]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_62], rax
+    mov rax, qword ptr [rip + v_46]
+    push rax
+    mov rax, qword ptr [rip + v_50]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_14], rax
+    mov rax, qword ptr [rip + v_68]
+    push rax
+    mov rax, qword ptr [rip + v_76]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_65], rax
+    mov rax, qword ptr [rip + v_24]
+    push rax
+    mov rax, qword ptr [rip + v_80]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_8], rax
+    mov rax, qword ptr [rip + v_87]
+    push rax
+    mov rax, qword ptr [rip + v_13]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_65], rax
+    mov rax, qword ptr [rip + v_13]
+    push rax
+    mov rax, qword ptr [rip + v_35]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_64], rax
+    mov rax, qword ptr [rip + v_52]
+    push rax
+    mov rax, qword ptr [rip + v_26]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_51], rax
+    mov rax, qword ptr [rip + v_90]
+    push rax
+    mov rax, qword ptr [rip + v_62]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_77], rax
+    mov rax, qword ptr [rip + v_43]
+    push rax
+    mov rax, qword ptr [rip + v_51]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_53], rax
+    mov rax, qword ptr [rip + v_34]
+    push rax
+    mov rax, qword ptr [rip + v_29]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_51], rax
+    mov rax, qword ptr [rip + v_8]
+    push rax
+    mov rax, qword ptr [rip + v_36]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_39], rax
+    mov rax, qword ptr [rip + v_73]
+    push rax
+    mov rax, qword ptr [rip + v_11]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_82], rax
+    mov rax, qword ptr [rip + v_69]
+    push rax
+    mov rax, qword ptr [rip + v_49]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_7], rax
+    mov rax, qword ptr [rip + v_75]
+    push rax
+    mov rax, qword ptr [rip + v_46]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_14], rax
+    mov rax, qword ptr [rip + v_76]
+    push rax
+    mov rax, qword ptr [rip + v_70]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_71], rax
+    mov rax, qword ptr [rip + v_87]
+    push rax
+    mov rax, qword ptr [rip + v_44]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_67], rax
+    mov rax, qword ptr [rip + v_85]
+    push rax
+    mov rax, qword ptr [rip + v_55]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_84], rax
+    mov rax, qword ptr [rip + v_64]
+    push rax
+    mov rax, qword ptr [rip + v_68]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_39], rax
+    mov rax, qword ptr [rip + v_23]
+    push rax
+    mov rax, qword ptr [rip + v_28]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_85], rax
+    mov rax, qword ptr [rip + v_49]
+    push rax
+    mov rax, qword ptr [rip + v_71]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_81], rax
+    mov rax, qword ptr [rip + v_88]
+    push rax
+    mov rax, qword ptr [rip + v_34]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_4], rax
+    mov rax, qword ptr [rip + v_56]
+    push rax
+    mov rax, qword ptr [rip + v_91]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_23], rax
+    mov rax, qword ptr [rip + v_19]
+    push rax
+    mov rax, qword ptr [rip + v_7]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_86], rax
+    mov rax, qword ptr [rip + v_69]
+    push rax
+    mov rax, qword ptr [rip + v_38]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_89], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_88]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_12], rax
+    mov rax, qword ptr [rip + v_33]
+    push rax
+    mov rax, qword ptr [rip + v_43]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_94], rax
+    mov rax, qword ptr [rip + v_7]
+    push rax
+    mov rax, qword ptr [rip + v_7]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_69], rax
+    mov rax, qword ptr [rip + v_65]
+    push rax
+    mov rax, qword ptr [rip + v_71]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_5]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_49], rax
+    mov rax, qword ptr [rip + v_50]
+    push rax
+    mov rax, qword ptr [rip + v_5]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_27], rax
+    mov rax, qword ptr [rip + v_10]
+    push rax
+    mov rax, qword ptr [rip + v_19]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_83], rax
+    mov rax, qword ptr [rip + v_66]
+    push rax
+    mov rax, qword ptr [rip + v_34]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_45], rax
+    mov rax, qword ptr [rip + v_95]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_8], rax
+    mov rax, qword ptr [rip + v_20]
+    push rax
+    mov rax, qword ptr [rip + v_31]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_55], rax
+    mov rax, qword ptr [rip + v_84]
+    push rax
+    mov rax, qword ptr [rip + v_84]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_91], rax
+    mov rax, qword ptr [rip + v_58]
+    push rax
+    mov rax, qword ptr [rip + v_53]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_24], rax
+    mov rax, qword ptr [rip + v_9]
+    push rax
+    mov rax, qword ptr [rip + v_83]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_19], rax
+    mov rax, qword ptr [rip + v_81]
+    push rax
+    mov rax, qword ptr [rip + v_93]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_76], rax
+    mov rax, qword ptr [rip + v_69]
+    push rax
+    mov rax, qword ptr [rip + v_81]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_62], rax
+    mov rax, qword ptr [rip + v_1]
+    push rax
+    mov rax, qword ptr [rip + v_53]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_82], rax
+    mov rax, qword ptr [rip + v_80]
+    push rax
+    mov rax, qword ptr [rip + v_16]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_4], rax
+    mov rax, qword ptr [rip + v_81]
+    push rax
+    mov rax, qword ptr [rip + v_22]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_16], rax
+    mov rax, qword ptr [rip + v_82]
+    push rax
+    mov rax, qword ptr [rip + v_79]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_8], rax
+    mov rax, qword ptr [rip + v_90]
+    push rax
+    mov rax, qword ptr [rip + v_10]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_61], rax
+    mov rax, qword ptr [rip + v_95]
+    push rax
+    mov rax, qword ptr [rip + v_65]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_55]
+    push rax
+    mov rax, qword ptr [rip + v_59]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_29], rax
+    mov rax, qword ptr [rip + v_42]
+    push rax
+    mov rax, qword ptr [rip + v_27]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_40], rax
+    mov rax, qword ptr [rip + v_6]
+    push rax
+    mov rax, qword ptr [rip + v_53]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_62], rax
+    mov rax, qword ptr [rip + v_92]
+    push rax
+    mov rax, qword ptr [rip + v_17]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_19], rax
+    mov rax, qword ptr [rip + v_80]
+    push rax
+    mov rax, qword ptr [rip + v_62]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_78], rax
+    mov rax, qword ptr [rip + v_41]
+    push rax
+    mov rax, qword ptr [rip + v_92]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_13], rax
+    mov rax, qword ptr [rip + v_86]
+    push rax
+    mov rax, qword ptr [rip + v_57]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_22], rax
+    mov rax, qword ptr [rip + v_70]
+    push rax
+    mov rax, qword ptr [rip + v_33]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_95], rax
+    mov rax, qword ptr [rip + v_87]
+    push rax
+    mov rax, qword ptr [rip + v_62]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_32], rax
+    mov rax, qword ptr [rip + v_89]
+    push rax
+    mov rax, qword ptr [rip + v_50]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_14], rax
+    mov rax, qword ptr [rip + v_28]
+    push rax
+    mov rax, qword ptr [rip + v_85]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_94], rax
+    mov rax, qword ptr [rip + v_49]
+    push rax
+    mov rax, qword ptr [rip + v_43]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_13], rax
+    mov rax, qword ptr [rip + v_49]
+    push rax
+    mov rax, qword ptr [rip + v_31]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_16], rax
+    mov rax, qword ptr [rip + v_59]
+    push rax
+    mov rax, qword ptr [rip + v_57]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_32], rax
+    mov rax, qword ptr [rip + v_95]
+    push rax
+    mov rax, qword ptr [rip + v_53]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_81], rax
+    mov rax, qword ptr [rip + v_56]
+    push rax
+    mov rax, qword ptr [rip + v_74]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_17], rax
+    mov rax, qword ptr [rip + v_7]
+    push rax
+    mov rax, qword ptr [rip + v_17]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_20], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_17]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_9], rax
+    mov rax, qword ptr [rip + v_72]
+    push rax
+    mov rax, qword ptr [rip + v_85]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_80], rax
+    mov rax, qword ptr [rip + v_37]
+    push rax
+    mov rax, qword ptr [rip + v_95]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_62], rax
+    mov rax, qword ptr [rip + v_46]
+    push rax
+    mov rax, qword ptr [rip + v_15]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_85]
+    push rax
+    mov rax, qword ptr [rip + v_8]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_34], rax
+    mov rax, qword ptr [rip + v_29]
+    push rax
+    mov rax, qword ptr [rip + v_29]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_33], rax
+    mov rax, qword ptr [rip + v_4]
+    push rax
+    mov rax, qword ptr [rip + v_21]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_66], rax
+    mov rax, qword ptr [rip + v_66]
+    push rax
+    mov rax, qword ptr [rip + v_15]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_22], rax
+    mov rax, qword ptr [rip + v_52]
+    push rax
+    mov rax, qword ptr [rip + v_20]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_73], rax
+    mov rax, qword ptr [rip + v_62]
+    push rax
+    mov rax, qword ptr [rip + v_33]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_58], rax
+    mov rax, qword ptr [rip + v_46]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_29], rax
+    mov rax, qword ptr [rip + v_88]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_69], rax
+    mov rax, qword ptr [rip + v_31]
+    push rax
+    mov rax, qword ptr [rip + v_23]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_49], rax
+    mov rax, qword ptr [rip + v_74]
+    push rax
+    mov rax, qword ptr [rip + v_75]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_77], rax
+    mov rax, qword ptr [rip + v_59]
+    push rax
+    mov rax, qword ptr [rip + v_66]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_36], rax
+    mov rax, qword ptr [rip + v_44]
+    push rax
+    mov rax, qword ptr [rip + v_74]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_44]
+    push rax
+    mov rax, qword ptr [rip + v_14]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_29], rax
+    mov rax, qword ptr [rip + v_27]
+    push rax
+    mov rax, qword ptr [rip + v_31]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_15], rax
+    mov rax, qword ptr [rip + v_4]
+    push rax
+    mov rax, qword ptr [rip + v_60]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_53], rax
+    mov rax, qword ptr [rip + v_31]
+    push rax
+    mov rax, qword ptr [rip + v_84]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_82], rax
+    mov rax, qword ptr [rip + v_6]
+    push rax
+    mov rax, qword ptr [rip + v_50]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_92], rax
+    mov rax, qword ptr [rip + v_57]
+    push rax
+    mov rax, qword ptr [rip + v_11]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_64], rax
+    mov rax, qword ptr [rip + v_59]
+    push rax
+    mov rax, qword ptr [rip + v_5]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_35], rax
+    mov rax, qword ptr [rip + v_31]
+    push rax
+    mov rax, qword ptr [rip + v_69]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_41], rax
+    mov rax, qword ptr [rip + v_52]
+    push rax
+    mov rax, qword ptr [rip + v_54]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_7]
+    push rax
+    mov rax, qword ptr [rip + v_26]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_84], rax
+    mov rax, qword ptr [rip + v_9]
+    push rax
+    mov rax, qword ptr [rip + v_12]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_24], rax
+    mov rax, qword ptr [rip + v_74]
+    push rax
+    mov rax, qword ptr [rip + v_43]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_95], rax
+    mov rax, qword ptr [rip + v_58]
+    push rax
+    mov rax, qword ptr [rip + v_11]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_79], rax
+    mov rax, qword ptr [rip + v_64]
+    push rax
+    mov rax, qword ptr [rip + v_45]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_19], rax
+    mov rax, qword ptr [rip + v_52]
+    push rax
+    mov rax, qword ptr [rip + v_84]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_82], rax
+    mov rax, qword ptr [rip + v_48]
+    push rax
+    mov rax, qword ptr [rip + v_78]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_81], rax
+    mov rax, qword ptr [rip + v_87]
+    push rax
+    mov rax, qword ptr [rip + v_18]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_22], rax
+    mov rax, qword ptr [rip + v_32]
+    push rax
+    mov rax, qword ptr [rip + v_62]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_73], rax
+    mov rax, qword ptr [rip + v_45]
+    push rax
+    mov rax, qword ptr [rip + v_83]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_68], rax
+    mov rax, qword ptr [rip + v_88]
+    push rax
+    mov rax, qword ptr [rip + v_35]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_86], rax
+    mov rax, qword ptr [rip + v_54]
+    push rax
+    mov rax, qword ptr [rip + v_34]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_40], rax
+    mov rax, qword ptr [rip + v_94]
+    push rax
+    mov rax, qword ptr [rip + v_18]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_49], rax
+    mov rax, qword ptr [rip + v_75]
+    push rax
+    mov rax, qword ptr [rip + v_64]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_95], rax
+    mov rax, qword ptr [rip + v_4]
+    push rax
+    mov rax, qword ptr [rip + v_18]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_32], rax
+    mov rax, qword ptr [rip + v_19]
+    push rax
+    mov rax, qword ptr [rip + v_55]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_14], rax
+    mov rax, qword ptr [rip + v_31]
+    push rax
+    mov rax, qword ptr [rip + v_38]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_13], rax
+    mov rax, qword ptr [rip + v_36]
+    push rax
+    mov rax, qword ptr [rip + v_6]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_13], rax
+    mov rax, qword ptr [rip + v_92]
+    push rax
+    mov rax, qword ptr [rip + v_55]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_9], rax
+    mov rax, qword ptr [rip + v_30]
+    push rax
+    mov rax, qword ptr [rip + v_65]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_38], rax
+    mov rax, qword ptr [rip + v_6]
+    push rax
+    mov rax, qword ptr [rip + v_40]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_5], rax
+    mov rax, qword ptr [rip + v_70]
+    push rax
+    mov rax, qword ptr [rip + v_37]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_56], rax
+    mov rax, qword ptr [rip + v_34]
+    push rax
+    mov rax, qword ptr [rip + v_30]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_47], rax
+    mov rax, qword ptr [rip + v_92]
+    push rax
+    mov rax, qword ptr [rip + v_63]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_64], rax
+    mov rax, qword ptr [rip + v_67]
+    push rax
+    mov rax, qword ptr [rip + v_29]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_10], rax
+    mov rax, qword ptr [rip + v_89]
+    push rax
+    mov rax, qword ptr [rip + v_23]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_12], rax
+    mov rax, qword ptr [rip + v_27]
+    push rax
+    mov rax, qword ptr [rip + v_13]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_61], rax
+    mov rax, qword ptr [rip + v_7]
+    push rax
+    mov rax, qword ptr [rip + v_95]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_84], rax
+    mov rax, qword ptr [rip + v_50]
+    push rax
+    mov rax, qword ptr [rip + v_86]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_95], rax
+    mov rax, qword ptr [rip + v_24]
+    push rax
+    mov rax, qword ptr [rip + v_95]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_14], rax
+    mov rax, qword ptr [rip + v_72]
+    push rax
+    mov rax, qword ptr [rip + v_40]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_83], rax
+    mov rax, qword ptr [rip + v_59]
+    push rax
+    mov rax, qword ptr [rip + v_7]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_92], rax
+    mov rax, qword ptr [rip + v_81]
+    push rax
+    mov rax, qword ptr [rip + v_23]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_6], rax
+    mov rax, qword ptr [rip + v_44]
+    push rax
+    mov rax, qword ptr [rip + v_89]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_68], rax
+    mov rax, qword ptr [rip + v_41]
+    push rax
+    mov rax, qword ptr [rip + v_13]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_71], rax
+    mov rax, qword ptr [rip + v_50]
+    push rax
+    mov rax, qword ptr [rip + v_67]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_77], rax
+    mov rax, qword ptr [rip + v_85]
+    push rax
+    mov rax, qword ptr [rip + v_87]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_75], rax
+    mov rax, qword ptr [rip + v_57]
+    push rax
+    mov rax, qword ptr [rip + v_41]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_77], rax
+    mov rax, qword ptr [rip + v_45]
+    push rax
+    mov rax, qword ptr [rip + v_26]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_59], rax
+    mov rax, qword ptr [rip + v_89]
+    push rax
+    mov rax, qword ptr [rip + v_61]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_4], rax
+    mov rax, qword ptr [rip + v_59]
+    push rax
+    mov rax, qword ptr [rip + v_57]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_9], rax
+    mov rax, qword ptr [rip + v_66]
+    push rax
+    mov rax, qword ptr [rip + v_53]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_91], rax
+    mov rax, qword ptr [rip + v_56]
+    push rax
+    mov rax, qword ptr [rip + v_81]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_20], rax
+    mov rax, qword ptr [rip + v_51]
+    push rax
+    mov rax, qword ptr [rip + v_33]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_28], rax
+    mov rax, qword ptr [rip + v_78]
+    push rax
+    mov rax, qword ptr [rip + v_89]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_75], rax
+    mov rax, qword ptr [rip + v_8]
+    push rax
+    mov rax, qword ptr [rip + v_67]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_92], rax
+    mov rax, qword ptr [rip + v_12]
+    push rax
+    mov rax, qword ptr [rip + v_63]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_54], rax
+    mov rax, qword ptr [rip + v_24]
+    push rax
+    mov rax, qword ptr [rip + v_70]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_33], rax
+    mov rax, qword ptr [rip + v_52]
+    push rax
+    mov rax, qword ptr [rip + v_68]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_81], rax
+    mov rax, qword ptr [rip + v_82]
+    push rax
+    mov rax, qword ptr [rip + v_73]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_20], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_63]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_71], rax
+    mov rax, qword ptr [rip + v_19]
+    push rax
+    mov rax, qword ptr [rip + v_60]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_84], rax
+    mov rax, qword ptr [rip + v_10]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_74], rax
+    mov rax, qword ptr [rip + v_26]
+    push rax
+    mov rax, qword ptr [rip + v_34]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_45], rax
+    mov rax, qword ptr [rip + v_13]
+    push rax
+    mov rax, qword ptr [rip + v_74]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_72], rax
+    mov rax, qword ptr [rip + v_25]
+    push rax
+    mov rax, qword ptr [rip + v_76]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_11]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_54], rax
+    mov rax, qword ptr [rip + v_11]
+    push rax
+    mov rax, qword ptr [rip + v_30]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_46], rax
+    mov rax, qword ptr [rip + v_79]
+    push rax
+    mov rax, qword ptr [rip + v_34]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_48], rax
+    mov rax, qword ptr [rip + v_39]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_31], rax
+    mov rax, qword ptr [rip + v_63]
+    push rax
+    mov rax, qword ptr [rip + v_29]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_19], rax
+    mov rax, qword ptr [rip + v_79]
+    push rax
+    mov rax, qword ptr [rip + v_38]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_35], rax
+    mov rax, qword ptr [rip + v_52]
+    push rax
+    mov rax, qword ptr [rip + v_78]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_40], rax
+    mov rax, qword ptr [rip + v_58]
+    push rax
+    mov rax, qword ptr [rip + v_21]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_86], rax
+    mov rax, qword ptr [rip + v_54]
+    push rax
+    mov rax, qword ptr [rip + v_36]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_44], rax
+    mov rax, qword ptr [rip + v_81]
+    push rax
+    mov rax, qword ptr [rip + v_55]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_13], rax
+    mov rax, qword ptr [rip + v_61]
+    push rax
+    mov rax, qword ptr [rip + v_27]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_71], rax
+    mov rax, qword ptr [rip + v_23]
+    push rax
+    mov rax, qword ptr [rip + v_24]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_36], rax
+    mov rax, qword ptr [rip + v_53]
+    push rax
+    mov rax, qword ptr [rip + v_75]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_58], rax
+    mov rax, qword ptr [rip + v_81]
+    push rax
+    mov rax, qword ptr [rip + v_33]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_11], rax
+    mov rax, qword ptr [rip + v_18]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_25], rax
+    mov rax, qword ptr [rip + v_29]
+    push rax
+    mov rax, qword ptr [rip + v_32]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_69], rax
+    mov rax, qword ptr [rip + v_53]
+    push rax
+    mov rax, qword ptr [rip + v_46]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_63], rax
+    mov rax, qword ptr [rip + v_48]
+    push rax
+    mov rax, qword ptr [rip + v_15]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_78], rax
+    mov rax, qword ptr [rip + v_14]
+    push rax
+    mov rax, qword ptr [rip + v_92]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_40], rax
+    mov rax, qword ptr [rip + v_94]
+    push rax
+    mov rax, qword ptr [rip + v_47]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_71], rax
+    mov rax, qword ptr [rip + v_21]
+    push rax
+    mov rax, qword ptr [rip + v_12]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_15], rax
+    mov rax, qword ptr [rip + v_22]
+    push rax
+    mov rax, qword ptr [rip + v_64]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_17], rax
+    mov rax, qword ptr [rip + v_90]
+    push rax
+    mov rax, qword ptr [rip + v_64]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_33], rax
+    mov rax, qword ptr [rip + v_55]
+    push rax
+    mov rax, qword ptr [rip + v_57]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_59], rax
+    mov rax, qword ptr [rip + v_65]
+    push rax
+    mov rax, qword ptr [rip + v_82]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_64], rax
+    mov rax, qword ptr [rip + v_47]
+    push rax
+    mov rax, qword ptr [rip + v_4]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_42], rax
+    mov rax, qword ptr [rip + v_69]
+    push rax
+    mov rax, qword ptr [rip + v_13]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_38], rax
+    mov rax, qword ptr [rip + v_21]
+    push rax
+    mov rax, qword ptr [rip + v_9]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_55], rax
+    mov rax, qword ptr [rip + v_42]
+    push rax
+    mov rax, qword ptr [rip + v_23]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_27], rax
+    mov rax, qword ptr [rip + v_89]
+    push rax
+    mov rax, qword ptr [rip + v_91]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_61], rax
+    mov rax, qword ptr [rip + v_76]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_15], rax
+    mov rax, qword ptr [rip + v_40]
+    push rax
+    mov rax, qword ptr [rip + v_42]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_60], rax
+    mov rax, qword ptr [rip + v_52]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_78], rax
+    mov rax, qword ptr [rip + v_20]
+    push rax
+    mov rax, qword ptr [rip + v_18]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_57], rax
+    mov rax, qword ptr [rip + v_28]
+    push rax
+    mov rax, qword ptr [rip + v_30]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_69], rax
+    mov rax, qword ptr [rip + v_28]
+    push rax
+    mov rax, qword ptr [rip + v_80]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_49], rax
+    mov rax, qword ptr [rip + v_18]
+    push rax
+    mov rax, qword ptr [rip + v_18]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_73], rax
+    mov rax, qword ptr [rip + v_30]
+    push rax
+    mov rax, qword ptr [rip + v_38]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_7], rax
+    mov rax, qword ptr [rip + v_7]
+    push rax
+    mov rax, qword ptr [rip + v_22]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_88], rax
+    mov rax, qword ptr [rip + v_15]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_78], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_57]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_15], rax
+    mov rax, qword ptr [rip + v_34]
+    push rax
+    mov rax, qword ptr [rip + v_93]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_18], rax
+    mov rax, qword ptr [rip + v_76]
+    push rax
+    mov rax, qword ptr [rip + v_91]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_64], rax
+    mov rax, qword ptr [rip + v_11]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_50], rax
+    mov rax, qword ptr [rip + v_61]
+    push rax
+    mov rax, qword ptr [rip + v_35]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_64], rax
+    mov rax, qword ptr [rip + v_66]
+    push rax
+    mov rax, qword ptr [rip + v_10]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_92], rax
+    mov rax, qword ptr [rip + v_90]
+    push rax
+    mov rax, qword ptr [rip + v_59]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_55], rax
+    mov rax, qword ptr [rip + v_79]
+    push rax
+    mov rax, qword ptr [rip + v_82]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_70], rax
+    mov rax, qword ptr [rip + v_7]
+    push rax
+    mov rax, qword ptr [rip + v_37]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_49], rax
+    mov rax, qword ptr [rip + v_28]
+    push rax
+    mov rax, qword ptr [rip + v_73]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_63], rax
+    mov rax, qword ptr [rip + v_30]
+    push rax
+    mov rax, qword ptr [rip + v_35]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_44], rax
+    mov rax, qword ptr [rip + v_14]
+    push rax
+    mov rax, qword ptr [rip + v_9]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_4], rax
+    mov rax, qword ptr [rip + v_94]
+    push rax
+    mov rax, qword ptr [rip + v_75]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_46], rax
+    mov rax, qword ptr [rip + v_67]
+    push rax
+    mov rax, qword ptr [rip + v_54]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_19], rax
+    mov rax, qword ptr [rip + v_37]
+    push rax
+    mov rax, qword ptr [rip + v_34]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_27], rax
+    mov rax, qword ptr [rip + v_26]
+    push rax
+    mov rax, qword ptr [rip + v_31]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_87], rax
+    mov rax, qword ptr [rip + v_11]
+    push rax
+    mov rax, qword ptr [rip + v_21]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_51], rax
+    mov rax, qword ptr [rip + v_48]
+    push rax
+    mov rax, qword ptr [rip + v_33]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_53], rax
+    mov rax, qword ptr [rip + v_43]
+    push rax
+    mov rax, qword ptr [rip + v_50]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_64], rax
+    mov rax, qword ptr [rip + v_82]
+    push rax
+    mov rax, qword ptr [rip + v_69]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_32], rax
+    mov rax, qword ptr [rip + v_43]
+    push rax
+    mov rax, qword ptr [rip + v_85]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_27], rax
+    mov rax, qword ptr [rip + v_36]
+    push rax
+    mov rax, qword ptr [rip + v_51]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_23], rax
+    mov rax, qword ptr [rip + v_7]
+    push rax
+    mov rax, qword ptr [rip + v_82]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_27], rax
+    mov rax, qword ptr [rip + v_70]
+    push rax
+    mov rax, qword ptr [rip + v_68]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_76], rax
+    mov rax, qword ptr [rip + v_34]
+    push rax
+    mov rax, qword ptr [rip + v_52]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_51], rax
+    mov rax, qword ptr [rip + v_84]
+    push rax
+    mov rax, qword ptr [rip + v_92]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_63], rax
+    mov rax, qword ptr [rip + v_10]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_81], rax
+    mov rax, qword ptr [rip + v_63]
+    push rax
+    mov rax, qword ptr [rip + v_63]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_4], rax
+    mov rax, qword ptr [rip + v_95]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_70], rax
+    mov rax, qword ptr [rip + v_12]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_47], rax
+    mov rax, qword ptr [rip + v_30]
+    push rax
+    mov rax, qword ptr [rip + v_31]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_5], rax
+    mov rax, qword ptr [rip + v_11]
+    push rax
+    mov rax, qword ptr [rip + v_68]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_36], rax
+    mov rax, qword ptr [rip + v_50]
+    push rax
+    mov rax, qword ptr [rip + v_81]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_16], rax
+    mov rax, qword ptr [rip + v_8]
+    push rax
+    mov rax, qword ptr [rip + v_5]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_25], rax
+    mov rax, qword ptr [rip + v_7]
+    push rax
+    mov rax, qword ptr [rip + v_85]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_15], rax
+    mov rax, qword ptr [rip + v_83]
+    push rax
+    mov rax, qword ptr [rip + v_54]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_42], rax
+    mov rax, qword ptr [rip + v_46]
+    push rax
+    mov rax, qword ptr [rip + v_86]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_19], rax
+    mov rax, qword ptr [rip + v_21]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_23], rax
+    mov rax, qword ptr [rip + v_26]
+    push rax
+    mov rax, qword ptr [rip + v_10]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_30], rax
+    mov rax, qword ptr [rip + v_78]
+    push rax
+    mov rax, qword ptr [rip + v_56]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_46], rax
+    mov rax, qword ptr [rip + v_71]
+    push rax
+    mov rax, qword ptr [rip + v_36]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_91], rax
+    mov rax, qword ptr [rip + v_31]
+    push rax
+    mov rax, qword ptr [rip + v_32]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_67], rax
+    mov rax, qword ptr [rip + v_29]
+    push rax
+    mov rax, qword ptr [rip + v_90]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_60], rax
+    mov rax, qword ptr [rip + v_79]
+    push rax
+    mov rax, qword ptr [rip + v_67]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_54], rax
+    mov rax, qword ptr [rip + v_16]
+    push rax
+    mov rax, qword ptr [rip + v_10]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_9], rax
+    mov rax, qword ptr [rip + v_83]
+    push rax
+    mov rax, qword ptr [rip + v_41]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_71], rax
+    mov rax, qword ptr [rip + v_41]
+    push rax
+    mov rax, qword ptr [rip + v_85]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_58], rax
+    mov rax, qword ptr [rip + v_33]
+    push rax
+    mov rax, qword ptr [rip + v_54]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_81]
+    push rax
+    mov rax, qword ptr [rip + v_22]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_81], rax
+    mov rax, qword ptr [rip + v_25]
+    push rax
+    mov rax, qword ptr [rip + v_10]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_28], rax
+    mov rax, qword ptr [rip + v_83]
+    push rax
+    mov rax, qword ptr [rip + v_64]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_22], rax
+    mov rax, qword ptr [rip + v_65]
+    push rax
+    mov rax, qword ptr [rip + v_7]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_47], rax
+    mov rax, qword ptr [rip + v_22]
+    push rax
+    mov rax, qword ptr [rip + v_24]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_11], rax
+    mov rax, qword ptr [rip + v_86]
+    push rax
+    mov rax, qword ptr [rip + v_14]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_47], rax
+    mov rax, qword ptr [rip + v_70]
+    push rax
+    mov rax, qword ptr [rip + v_68]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_48], rax
+    mov rax, qword ptr [rip + v_65]
+    push rax
+    mov rax, qword ptr [rip + v_19]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_5], rax
+    mov rax, qword ptr [rip + v_28]
+    push rax
+    mov rax, qword ptr [rip + v_59]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_90], rax
+    mov rax, qword ptr [rip + v_70]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_93], rax
+    mov rax, qword ptr [rip + v_93]
+    push rax
+    mov rax, qword ptr [rip + v_68]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_59], rax
+    mov rax, qword ptr [rip + v_11]
+    push rax
+    mov rax, qword ptr [rip + v_51]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_16], rax
+    mov rax, qword ptr [rip + v_38]
+    push rax
+    mov rax, qword ptr [rip + v_63]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_12], rax
+    mov rax, qword ptr [rip + v_14]
+    push rax
+    mov rax, qword ptr [rip + v_78]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_31], rax
+    mov rax, qword ptr [rip + v_82]
+    push rax
+    mov rax, qword ptr [rip + v_49]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_67], rax
+    mov rax, qword ptr [rip + v_32]
+    push rax
+    mov rax, qword ptr [rip + v_46]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_86], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_75]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_11], rax
+    mov rax, qword ptr [rip + v_46]
+    push rax
+    mov rax, qword ptr [rip + v_75]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_12], rax
+    mov rax, qword ptr [rip + v_67]
+    push rax
+    mov rax, qword ptr [rip + v_25]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_84], rax
+    mov rax, qword ptr [rip + v_61]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_23], rax
+    mov rax, qword ptr [rip + v_73]
+    push rax
+    mov rax, qword ptr [rip + v_65]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_48], rax
+    mov rax, qword ptr [rip + v_49]
+    push rax
+    mov rax, qword ptr [rip + v_18]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_9], rax
+    mov rax, qword ptr [rip + v_32]
+    push rax
+    mov rax, qword ptr [rip + v_29]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_91], rax
+    mov rax, qword ptr [rip + v_25]
+    push rax
+    mov rax, qword ptr [rip + v_78]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_55], rax
+    mov rax, qword ptr [rip + v_64]
+    push rax
+    mov rax, qword ptr [rip + v_43]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_27], rax
+    mov rax, qword ptr [rip + v_57]
+    push rax
+    mov rax, qword ptr [rip + v_60]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_63], rax
+    mov rax, qword ptr [rip + v_13]
+    push rax
+    mov rax, qword ptr [rip + v_93]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_48], rax
+    mov rax, qword ptr [rip + v_74]
+    push rax
+    mov rax, qword ptr [rip + v_14]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_82], rax
+    mov rax, qword ptr [rip + v_39]
+    push rax
+    mov rax, qword ptr [rip + v_64]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_75], rax
+    mov rax, qword ptr [rip + v_89]
+    push rax
+    mov rax, qword ptr [rip + v_9]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_50], rax
+    mov rax, qword ptr [rip + v_56]
+    push rax
+    mov rax, qword ptr [rip + v_53]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_84], rax
+    mov rax, qword ptr [rip + v_59]
+    push rax
+    mov rax, qword ptr [rip + v_43]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_14], rax
+    mov rax, qword ptr [rip + v_8]
+    push rax
+    mov rax, qword ptr [rip + v_22]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_7], rax
+    mov rax, qword ptr [rip + v_4]
+    push rax
+    mov rax, qword ptr [rip + v_12]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_49], rax
+    mov rax, qword ptr [rip + v_85]
+    push rax
+    mov rax, qword ptr [rip + v_72]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_45], rax
+    mov rax, qword ptr [rip + v_40]
+    push rax
+    mov rax, qword ptr [rip + v_16]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_76], rax
+    mov rax, qword ptr [rip + v_95]
+    push rax
+    mov rax, qword ptr [rip + v_63]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_73], rax
+    mov rax, qword ptr [rip + v_19]
+    push rax
+    mov rax, qword ptr [rip + v_75]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_82], rax
+    mov rax, qword ptr [rip + v_87]
+    push rax
+    mov rax, qword ptr [rip + v_60]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_7], rax
+    mov rax, qword ptr [rip + v_58]
+    push rax
+    mov rax, qword ptr [rip + v_34]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_47], rax
+    mov rax, qword ptr [rip + v_53]
+    push rax
+    mov rax, qword ptr [rip + v_63]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_53], rax
+    mov rax, qword ptr [rip + v_59]
+    push rax
+    mov rax, qword ptr [rip + v_44]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_83], rax
+    mov rax, qword ptr [rip + v_22]
+    push rax
+    mov rax, qword ptr [rip + v_59]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_30], rax
+    mov rax, qword ptr [rip + v_84]
+    push rax
+    mov rax, qword ptr [rip + v_18]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_78], rax
+    mov rax, qword ptr [rip + v_68]
+    push rax
+    mov rax, qword ptr [rip + v_34]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_25], rax
+    mov rax, qword ptr [rip + v_79]
+    push rax
+    mov rax, qword ptr [rip + v_76]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_7], rax
+    mov rax, qword ptr [rip + v_75]
+    push rax
+    mov rax, qword ptr [rip + v_18]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_81], rax
+    mov rax, qword ptr [rip + v_79]
+    push rax
+    mov rax, qword ptr [rip + v_6]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_4], rax
+    mov rax, qword ptr [rip + v_26]
+    push rax
+    mov rax, qword ptr [rip + v_92]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_88], rax
+    mov rax, qword ptr [rip + v_26]
+    push rax
+    mov rax, qword ptr [rip + v_73]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_51], rax
+    mov rax, qword ptr [rip + v_77]
+    push rax
+    mov rax, qword ptr [rip + v_74]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_8], rax
+    mov rax, qword ptr [rip + v_27]
+    push rax
+    mov rax, qword ptr [rip + v_81]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_87], rax
+    mov rax, qword ptr [rip + v_64]
+    push rax
+    mov rax, qword ptr [rip + v_23]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_78], rax
+    mov rax, qword ptr [rip + v_61]
+    push rax
+    mov rax, qword ptr [rip + v_41]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_34], rax
+    mov rax, qword ptr [rip + v_13]
+    push rax
+    mov rax, qword ptr [rip + v_33]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_51], rax
+    mov rax, qword ptr [rip + v_54]
+    push rax
+    mov rax, qword ptr [rip + v_41]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_49], rax
+    mov rax, qword ptr [rip + v_29]
+    push rax
+    mov rax, qword ptr [rip + v_51]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_23], rax
+    mov rax, qword ptr [rip + v_14]
+    push rax
+    mov rax, qword ptr [rip + v_24]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_67], rax
+    mov rax, qword ptr [rip + v_5]
+    push rax
+    mov rax, qword ptr [rip + v_82]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_77], rax
+    mov rax, qword ptr [rip + v_88]
+    push rax
+    mov rax, qword ptr [rip + v_15]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_32], rax
+    mov rax, qword ptr [rip + v_24]
+    push rax
+    mov rax, qword ptr [rip + v_40]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_14], rax
+    mov rax, qword ptr [rip + v_88]
+    push rax
+    mov rax, qword ptr [rip + v_46]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_48], rax
+    mov rax, qword ptr [rip + v_9]
+    push rax
+    mov rax, qword ptr [rip + v_27]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_50]
+    push rax
+    mov rax, qword ptr [rip + v_82]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_16], rax
+    mov rax, qword ptr [rip + v_14]
+    push rax
+    mov rax, qword ptr [rip + v_20]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_4], rax
+    mov rax, qword ptr [rip + v_12]
+    push rax
+    mov rax, qword ptr [rip + v_9]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_94], rax
+    mov rax, qword ptr [rip + v_5]
+    push rax
+    mov rax, qword ptr [rip + v_35]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_41], rax
+    mov rax, qword ptr [rip + v_62]
+    push rax
+    mov rax, qword ptr [rip + v_19]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_53], rax
+    mov rax, qword ptr [rip + v_83]
+    push rax
+    mov rax, qword ptr [rip + v_34]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_48], rax
+    mov rax, qword ptr [rip + v_49]
+    push rax
+    mov rax, qword ptr [rip + v_22]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_17], rax
+    mov rax, qword ptr [rip + v_61]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_15], rax
+    mov rax, qword ptr [rip + v_67]
+    push rax
+    mov rax, qword ptr [rip + v_36]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_84], rax
+    mov rax, qword ptr [rip + v_78]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_20], rax
+    mov rax, qword ptr [rip + v_30]
+    push rax
+    mov rax, qword ptr [rip + v_24]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_45], rax
+    mov rax, qword ptr [rip + v_7]
+    push rax
+    mov rax, qword ptr [rip + v_72]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_86], rax
+    mov rax, qword ptr [rip + v_89]
+    push rax
+    mov rax, qword ptr [rip + v_92]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_95], rax
+    mov rax, qword ptr [rip + v_25]
+    push rax
+    mov rax, qword ptr [rip + v_6]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_50], rax
+    mov rax, qword ptr [rip + v_23]
+    push rax
+    mov rax, qword ptr [rip + v_9]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_37], rax
+    mov rax, qword ptr [rip + v_44]
+    push rax
+    mov rax, qword ptr [rip + v_49]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_17], rax
+    mov rax, qword ptr [rip + v_83]
+    push rax
+    mov rax, qword ptr [rip + v_65]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_19], rax
+    mov rax, qword ptr [rip + v_59]
+    push rax
+    mov rax, qword ptr [rip + v_47]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_10], rax
+    mov rax, qword ptr [rip + v_92]
+    push rax
+    mov rax, qword ptr [rip + v_38]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_74], rax
+    mov rax, qword ptr [rip + v_76]
+    push rax
+    mov rax, qword ptr [rip + v_83]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_62], rax
+    mov rax, qword ptr [rip + v_13]
+    push rax
+    mov rax, qword ptr [rip + v_57]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_14], rax
+    mov rax, qword ptr [rip + v_43]
+    push rax
+    mov rax, qword ptr [rip + v_24]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_86], rax
+    mov rax, qword ptr [rip + v_21]
+    push rax
+    mov rax, qword ptr [rip + v_58]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_62], rax
+    mov rax, qword ptr [rip + v_33]
+    push rax
+    mov rax, qword ptr [rip + v_36]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_53], rax
+    mov rax, qword ptr [rip + v_83]
+    push rax
+    mov rax, qword ptr [rip + v_83]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_72], rax
+    mov rax, qword ptr [rip + v_76]
+    push rax
+    mov rax, qword ptr [rip + v_16]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_89], rax
+    mov rax, qword ptr [rip + v_12]
+    push rax
+    mov rax, qword ptr [rip + v_40]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_26], rax
+    mov rax, qword ptr [rip + v_48]
+    push rax
+    mov rax, qword ptr [rip + v_38]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_44], rax
+    mov rax, qword ptr [rip + v_34]
+    push rax
+    mov rax, qword ptr [rip + v_51]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_25], rax
+    mov rax, qword ptr [rip + v_68]
+    push rax
+    mov rax, qword ptr [rip + v_70]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_64], rax
+    mov rax, qword ptr [rip + v_40]
+    push rax
+    mov rax, qword ptr [rip + v_49]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_16], rax
+    mov rax, qword ptr [rip + v_70]
+    push rax
+    mov rax, qword ptr [rip + v_92]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_91], rax
+    mov rax, qword ptr [rip + v_71]
+    push rax
+    mov rax, qword ptr [rip + v_7]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_73], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_63]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_83], rax
+    mov rax, qword ptr [rip + v_5]
+    push rax
+    mov rax, qword ptr [rip + v_46]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_48], rax
+    mov rax, qword ptr [rip + v_33]
+    push rax
+    mov rax, qword ptr [rip + v_6]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_88], rax
+    mov rax, qword ptr [rip + v_91]
+    push rax
+    mov rax, qword ptr [rip + v_43]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_47], rax
+    mov rax, qword ptr [rip + v_83]
+    push rax
+    mov rax, qword ptr [rip + v_31]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_6], rax
+    mov rax, qword ptr [rip + v_32]
+    push rax
+    mov rax, qword ptr [rip + v_28]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_65], rax
+    mov rax, qword ptr [rip + v_9]
+    push rax
+    mov rax, qword ptr [rip + v_31]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_62], rax
+    mov rax, qword ptr [rip + v_5]
+    push rax
+    mov rax, qword ptr [rip + v_43]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_62], rax
+    mov rax, qword ptr [rip + v_72]
+    push rax
+    mov rax, qword ptr [rip + v_31]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_19], rax
+    mov rax, qword ptr [rip + v_63]
+    push rax
+    mov rax, qword ptr [rip + v_14]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_78], rax
+    mov rax, qword ptr [rip + v_67]
+    push rax
+    mov rax, qword ptr [rip + v_57]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_68], rax
+    mov rax, qword ptr [rip + v_21]
+    push rax
+    mov rax, qword ptr [rip + v_57]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_33], rax
+    mov rax, qword ptr [rip + v_82]
+    push rax
+    mov rax, qword ptr [rip + v_95]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_62], rax
+    mov rax, qword ptr [rip + v_57]
+    push rax
+    mov rax, qword ptr [rip + v_21]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_66], rax
+    mov rax, qword ptr [rip + v_42]
+    push rax
+    mov rax, qword ptr [rip + v_30]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_28], rax
+    mov rax, qword ptr [rip + v_19]
+    push rax
+    mov rax, qword ptr [rip + v_24]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_92], rax
+    mov rax, qword ptr [rip + v_92]
+    push rax
+    mov rax, qword ptr [rip + v_21]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_83], rax
+    mov rax, qword ptr [rip + v_65]
+    push rax
+    mov rax, qword ptr [rip + v_94]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_41], rax
+    mov rax, qword ptr [rip + v_58]
+    push rax
+    mov rax, qword ptr [rip + v_30]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_16], rax
+    mov rax, qword ptr [rip + v_48]
+    push rax
+    mov rax, qword ptr [rip + v_61]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_18], rax
+    mov rax, qword ptr [rip + v_28]
+    push rax
+    mov rax, qword ptr [rip + v_41]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_53], rax
+    mov rax, qword ptr [rip + v_80]
+    push rax
+    mov rax, qword ptr [rip + v_23]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_28], rax
+    mov rax, qword ptr [rip + v_62]
+    push rax
+    mov rax, qword ptr [rip + v_48]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_38], rax
+    mov rax, qword ptr [rip + v_82]
+    push rax
+    mov rax, qword ptr [rip + v_82]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_23], rax
+    mov rax, qword ptr [rip + v_25]
+    push rax
+    mov rax, qword ptr [rip + v_95]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_49], rax
+    mov rax, qword ptr [rip + v_61]
+    push rax
+    mov rax, qword ptr [rip + v_34]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_93], rax
+    mov rax, qword ptr [rip + v_46]
+    push rax
+    mov rax, qword ptr [rip + v_33]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_35], rax
+    mov rax, qword ptr [rip + v_85]
+    push rax
+    mov rax, qword ptr [rip + v_54]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_46], rax
+    mov rax, qword ptr [rip + v_46]
+    push rax
+    mov rax, qword ptr [rip + v_8]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_12], rax
+    mov rax, qword ptr [rip + v_15]
+    push rax
+    mov rax, qword ptr [rip + v_16]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_25], rax
+    mov rax, qword ptr [rip + v_27]
+    push rax
+    mov rax, qword ptr [rip + v_11]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_66], rax
+    mov rax, qword ptr [rip + v_55]
+    push rax
+    mov rax, qword ptr [rip + v_17]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_47], rax
+    mov rax, qword ptr [rip + v_45]
+    push rax
+    mov rax, qword ptr [rip + v_77]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_57], rax
+    mov rax, qword ptr [rip + v_41]
+    push rax
+    mov rax, qword ptr [rip + v_4]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_46], rax
+    mov rax, qword ptr [rip + v_95]
+    push rax
+    mov rax, qword ptr [rip + v_73]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_90], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_19]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_78], rax
+    mov rax, qword ptr [rip + v_59]
+    push rax
+    mov rax, qword ptr [rip + v_48]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_56], rax
+    mov rax, qword ptr [rip + v_41]
+    push rax
+    mov rax, qword ptr [rip + v_76]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_71], rax
+    mov rax, qword ptr [rip + v_57]
+    push rax
+    mov rax, qword ptr [rip + v_41]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_12], rax
+    mov rax, qword ptr [rip + v_55]
+    push rax
+    mov rax, qword ptr [rip + v_18]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_62], rax
+    mov rax, qword ptr [rip + v_81]
+    push rax
+    mov rax, qword ptr [rip + v_59]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_29], rax
+    mov rax, qword ptr [rip + v_70]
+    push rax
+    mov rax, qword ptr [rip + v_61]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_57], rax
+    mov rax, qword ptr [rip + v_34]
+    push rax
+    mov rax, qword ptr [rip + v_5]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_24], rax
+    mov rax, qword ptr [rip + v_7]
+    push rax
+    mov rax, qword ptr [rip + v_8]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_40], rax
+    mov rax, qword ptr [rip + v_94]
+    push rax
+    mov rax, qword ptr [rip + v_70]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_7], rax
+    mov rax, qword ptr [rip + v_5]
+    push rax
+    mov rax, qword ptr [rip + v_61]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_8], rax
+    mov rax, qword ptr [rip + v_44]
+    push rax
+    mov rax, qword ptr [rip + v_36]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_34], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_47]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_51], rax
+    mov rax, qword ptr [rip + v_59]
+    push rax
+    mov rax, qword ptr [rip + v_79]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_56], rax
+    mov rax, qword ptr [rip + v_4]
+    push rax
+    mov rax, qword ptr [rip + v_8]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_26], rax
+    mov rax, qword ptr [rip + v_78]
+    push rax
+    mov rax, qword ptr [rip + v_91]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_42], rax
+    mov rax, qword ptr [rip + v_95]
+    push rax
+    mov rax, qword ptr [rip + v_27]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_59], rax
+    mov rax, qword ptr [rip + v_84]
+    push rax
+    mov rax, qword ptr [rip + v_19]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_49], rax
+    mov rax, qword ptr [rip + v_67]
+    push rax
+    mov rax, qword ptr [rip + v_34]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_68], rax
+    mov rax, qword ptr [rip + v_17]
+    push rax
+    mov rax, qword ptr [rip + v_59]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_86], rax
+    mov rax, qword ptr [rip + v_4]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_4], rax
+    mov rax, qword ptr [rip + v_53]
+    push rax
+    mov rax, qword ptr [rip + v_40]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_54], rax
+    mov rax, qword ptr [rip + v_94]
+    push rax
+    mov rax, qword ptr [rip + v_6]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_68], rax
+    mov rax, qword ptr [rip + v_26]
+    push rax
+    mov rax, qword ptr [rip + v_11]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_55], rax
+    mov rax, qword ptr [rip + v_88]
+    push rax
+    mov rax, qword ptr [rip + v_32]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_94], rax
+    mov rax, qword ptr [rip + v_36]
+    push rax
+    mov rax, qword ptr [rip + v_11]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_69], rax
+    mov rax, qword ptr [rip + v_45]
+    push rax
+    mov rax, qword ptr [rip + v_61]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_13], rax
+    mov rax, qword ptr [rip + v_89]
+    push rax
+    mov rax, qword ptr [rip + v_28]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_77], rax
+    mov rax, qword ptr [rip + v_65]
+    push rax
+    mov rax, qword ptr [rip + v_52]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_14], rax
+    mov rax, qword ptr [rip + v_71]
+    push rax
+    mov rax, qword ptr [rip + v_42]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_36], rax
+    mov rax, qword ptr [rip + v_74]
+    push rax
+    mov rax, qword ptr [rip + v_56]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_40], rax
+    mov rax, qword ptr [rip + v_67]
+    push rax
+    mov rax, qword ptr [rip + v_71]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_72], rax
+    mov rax, qword ptr [rip + v_92]
+    push rax
+    mov rax, qword ptr [rip + v_10]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_88], rax
+    mov rax, qword ptr [rip + v_83]
+    push rax
+    mov rax, qword ptr [rip + v_13]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_56], rax
+    mov rax, qword ptr [rip + v_20]
+    push rax
+    mov rax, qword ptr [rip + v_43]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_24], rax
+    mov rax, qword ptr [rip + v_76]
+    push rax
+    mov rax, qword ptr [rip + v_29]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_70], rax
+    mov rax, qword ptr [rip + v_80]
+    push rax
+    mov rax, qword ptr [rip + v_46]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_27], rax
+    mov rax, qword ptr [rip + v_83]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_43], rax
+    mov rax, qword ptr [rip + v_92]
+    push rax
+    mov rax, qword ptr [rip + v_23]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_30], rax
+    mov rax, qword ptr [rip + v_84]
+    push rax
+    mov rax, qword ptr [rip + v_14]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_61], rax
+    mov rax, qword ptr [rip + v_31]
+    push rax
+    mov rax, qword ptr [rip + v_26]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_18], rax
+    mov rax, qword ptr [rip + v_64]
+    push rax
+    mov rax, qword ptr [rip + v_34]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_36], rax
+    mov rax, qword ptr [rip + v_83]
+    push rax
+    mov rax, qword ptr [rip + v_77]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_32], rax
+    mov rax, qword ptr [rip + v_91]
+    push rax
+    mov rax, qword ptr [rip + v_25]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_25], rax
+    mov rax, qword ptr [rip + v_7]
+    push rax
+    mov rax, qword ptr [rip + v_72]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_12], rax
+    mov rax, qword ptr [rip + v_53]
+    push rax
+    mov rax, qword ptr [rip + v_63]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_23], rax
+    mov rax, qword ptr [rip + v_11]
+    push rax
+    mov rax, qword ptr [rip + v_79]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_83], rax
+    mov rax, qword ptr [rip + v_31]
+    push rax
+    mov rax, qword ptr [rip + v_36]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_93], rax
+    mov rax, qword ptr [rip + v_19]
+    push rax
+    mov rax, qword ptr [rip + v_14]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_32], rax
+    mov rax, qword ptr [rip + v_17]
+    push rax
+    mov rax, qword ptr [rip + v_52]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_85], rax
+    mov rax, qword ptr [rip + v_58]
+    push rax
+    mov rax, qword ptr [rip + v_81]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_89], rax
+    mov rax, qword ptr [rip + v_78]
+    push rax
+    mov rax, qword ptr [rip + v_37]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_80], rax
+    mov rax, qword ptr [rip + v_48]
+    push rax
+    mov rax, qword ptr [rip + v_89]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_95], rax
+    mov rax, qword ptr [rip + v_41]
+    push rax
+    mov rax, qword ptr [rip + v_95]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_40], rax
+    mov rax, qword ptr [rip + v_77]
+    push rax
+    mov rax, qword ptr [rip + v_13]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_59], rax
+    mov rax, qword ptr [rip + v_92]
+    push rax
+    mov rax, qword ptr [rip + v_10]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_6], rax
+    mov rax, qword ptr [rip + v_58]
+    push rax
+    mov rax, qword ptr [rip + v_94]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_10], rax
+    mov rax, qword ptr [rip + v_89]
+    push rax
+    mov rax, qword ptr [rip + v_65]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_63], rax
+    mov rax, qword ptr [rip + v_6]
+    push rax
+    mov rax, qword ptr [rip + v_68]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_83], rax
+    mov rax, qword ptr [rip + v_52]
+    push rax
+    mov rax, qword ptr [rip + v_55]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_87], rax
+    mov rax, qword ptr [rip + v_21]
+    push rax
+    mov rax, qword ptr [rip + v_67]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_78], rax
+    mov rax, qword ptr [rip + v_4]
+    push rax
+    mov rax, qword ptr [rip + v_70]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_28], rax
+    mov rax, qword ptr [rip + v_90]
+    push rax
+    mov rax, qword ptr [rip + v_85]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_74], rax
+    mov rax, qword ptr [rip + v_19]
+    push rax
+    mov rax, qword ptr [rip + v_84]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_67], rax
+    mov rax, qword ptr [rip + v_23]
+    push rax
+    mov rax, qword ptr [rip + v_22]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_84], rax
+    mov rax, qword ptr [rip + v_55]
+    push rax
+    mov rax, qword ptr [rip + v_70]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_73], rax
+    mov rax, qword ptr [rip + v_45]
+    push rax
+    mov rax, qword ptr [rip + v_5]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_8], rax
+    mov rax, qword ptr [rip + v_15]
+    push rax
+    mov rax, qword ptr [rip + v_82]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_64], rax
+    mov rax, qword ptr [rip + v_24]
+    push rax
+    mov rax, qword ptr [rip + v_69]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_64], rax
+    mov rax, qword ptr [rip + v_38]
+    push rax
+    mov rax, qword ptr [rip + v_81]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_33], rax
+    mov rax, qword ptr [rip + v_8]
+    push rax
+    mov rax, qword ptr [rip + v_57]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_39], rax
+    mov rax, qword ptr [rip + v_65]
+    push rax
+    mov rax, qword ptr [rip + v_25]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_68], rax
+    mov rax, qword ptr [rip + v_72]
+    push rax
+    mov rax, qword ptr [rip + v_40]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_43], rax
+    mov rax, qword ptr [rip + v_10]
+    push rax
+    mov rax, qword ptr [rip + v_60]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_57], rax
+    mov rax, qword ptr [rip + v_17]
+    push rax
+    mov rax, qword ptr [rip + v_26]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_9], rax
+    mov rax, qword ptr [rip + v_39]
+    push rax
+    mov rax, qword ptr [rip + v_52]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_87], rax
+    mov rax, qword ptr [rip + v_7]
+    push rax
+    mov rax, qword ptr [rip + v_10]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_62], rax
+    mov rax, qword ptr [rip + v_65]
+    push rax
+    mov rax, qword ptr [rip + v_86]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_58], rax
+    mov rax, qword ptr [rip + v_20]
+    push rax
+    mov rax, qword ptr [rip + v_76]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_88], rax
+    mov rax, qword ptr [rip + v_38]
+    push rax
+    mov rax, qword ptr [rip + v_36]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_94], rax
+    mov rax, qword ptr [rip + v_36]
+    push rax
+    mov rax, qword ptr [rip + v_20]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_77], rax
+    mov rax, qword ptr [rip + v_48]
+    push rax
+    mov rax, qword ptr [rip + v_9]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_51], rax
+    mov rax, qword ptr [rip + v_44]
+    push rax
+    mov rax, qword ptr [rip + v_32]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_28], rax
+    mov rax, qword ptr [rip + v_87]
+    push rax
+    mov rax, qword ptr [rip + v_74]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_91], rax
+    mov rax, qword ptr [rip + v_30]
+    push rax
+    mov rax, qword ptr [rip + v_76]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_29], rax
+    mov rax, qword ptr [rip + v_22]
+    push rax
+    mov rax, qword ptr [rip + v_93]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_74], rax
+    mov rax, qword ptr [rip + v_92]
+    push rax
+    mov rax, qword ptr [rip + v_81]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_29], rax
+    mov rax, qword ptr [rip + v_10]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_23], rax
+    mov rax, qword ptr [rip + v_69]
+    push rax
+    mov rax, qword ptr [rip + v_60]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_60], rax
+    mov rax, qword ptr [rip + v_13]
+    push rax
+    mov rax, qword ptr [rip + v_23]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_40], rax
+    mov rax, qword ptr [rip + v_55]
+    push rax
+    mov rax, qword ptr [rip + v_68]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_52], rax
+    mov rax, qword ptr [rip + v_78]
+    push rax
+    mov rax, qword ptr [rip + v_24]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_22], rax
+    mov rax, qword ptr [rip + v_9]
+    push rax
+    mov rax, qword ptr [rip + v_16]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_63], rax
+    mov rax, qword ptr [rip + v_5]
+    push rax
+    mov rax, qword ptr [rip + v_90]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_20], rax
+    mov rax, qword ptr [rip + v_31]
+    push rax
+    mov rax, qword ptr [rip + v_59]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_50], rax
+    mov rax, qword ptr [rip + v_17]
+    push rax
+    mov rax, qword ptr [rip + v_54]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_20]
+    push rax
+    mov rax, qword ptr [rip + v_25]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_56]
+    push rax
+    mov rax, qword ptr [rip + v_8]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_50], rax
+    mov rax, qword ptr [rip + v_42]
+    push rax
+    mov rax, qword ptr [rip + v_87]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_9], rax
+    mov rax, qword ptr [rip + v_25]
+    push rax
+    mov rax, qword ptr [rip + v_61]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_9], rax
+    mov rax, qword ptr [rip + v_83]
+    push rax
+    mov rax, qword ptr [rip + v_25]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_37], rax
+    mov rax, qword ptr [rip + v_33]
+    push rax
+    mov rax, qword ptr [rip + v_53]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_68], rax
+    mov rax, qword ptr [rip + v_46]
+    push rax
+    mov rax, qword ptr [rip + v_44]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_55], rax
+    mov rax, qword ptr [rip + v_6]
+    push rax
+    mov rax, qword ptr [rip + v_20]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_16], rax
+    mov rax, qword ptr [rip + v_92]
+    push rax
+    mov rax, qword ptr [rip + v_29]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_5], rax
+    mov rax, qword ptr [rip + v_68]
+    push rax
+    mov rax, qword ptr [rip + v_28]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_63], rax
+    mov rax, qword ptr [rip + v_85]
+    push rax
+    mov rax, qword ptr [rip + v_53]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_82], rax
+    mov rax, qword ptr [rip + v_59]
+    push rax
+    mov rax, qword ptr [rip + v_95]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_5], rax
+    mov rax, qword ptr [rip + v_89]
+    push rax
+    mov rax, qword ptr [rip + v_50]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_88], rax
+    mov rax, qword ptr [rip + v_82]
+    push rax
+    mov rax, qword ptr [rip + v_67]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_3], rax
+    mov rax, qword ptr [rip + v_7]
+    push rax
+    mov rax, qword ptr [rip + v_65]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_10], rax
+    mov rax, qword ptr [rip + v_48]
+    push rax
+    mov rax, qword ptr [rip + v_33]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_24], rax
+    mov rax, qword ptr [rip + v_42]
+    push rax
+    mov rax, qword ptr [rip + v_68]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_92], rax
+    mov rax, qword ptr [rip + v_50]
+    push rax
+    mov rax, qword ptr [rip + v_78]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_91]
+    push rax
+    mov rax, qword ptr [rip + v_44]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_22], rax
+    mov rax, qword ptr [rip + v_16]
+    push rax
+    mov rax, qword ptr [rip + v_58]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_69], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_69]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_54], rax
+    mov rax, qword ptr [rip + v_81]
+    push rax
+    mov rax, qword ptr [rip + v_8]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_94], rax
+    mov rax, qword ptr [rip + v_22]
+    push rax
+    mov rax, qword ptr [rip + v_49]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_74], rax
+    mov rax, qword ptr [rip + v_6]
+    push rax
+    mov rax, qword ptr [rip + v_37]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_32], rax
+    mov rax, qword ptr [rip + v_66]
+    push rax
+    mov rax, qword ptr [rip + v_68]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_44], rax
+    mov rax, qword ptr [rip + v_17]
+    push rax
+    mov rax, qword ptr [rip + v_94]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_15], rax
+    mov rax, qword ptr [rip + v_24]
+    push rax
+    mov rax, qword ptr [rip + v_37]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_34], rax
+    mov rax, qword ptr [rip + v_57]
+    push rax
+    mov rax, qword ptr [rip + v_70]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_87], rax
+    mov rax, qword ptr [rip + v_62]
+    push rax
+    mov rax, qword ptr [rip + v_71]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_20], rax
+    mov rax, qword ptr [rip + v_83]
+    push rax
+    mov rax, qword ptr [rip + v_70]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_32], rax
+    mov rax, qword ptr [rip + v_92]
+    push rax
+    mov rax, qword ptr [rip + v_81]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_53], rax
+    mov rax, qword ptr [rip + v_55]
+    push rax
+    mov rax, qword ptr [rip + v_39]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_93], rax
+    mov rax, qword ptr [rip + v_8]
+    push rax
+    mov rax, qword ptr [rip + v_40]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_22], rax
+    mov rax, qword ptr [rip + v_44]
+    push rax
+    mov rax, qword ptr [rip + v_18]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_67], rax
+    mov rax, qword ptr [rip + v_30]
+    push rax
+    mov rax, qword ptr [rip + v_32]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_77], rax
+    mov rax, qword ptr [rip + v_51]
+    push rax
+    mov rax, qword ptr [rip + v_83]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_44], rax
+    mov rax, qword ptr [rip + v_12]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_41], rax
+    mov rax, qword ptr [rip + v_12]
+    push rax
+    mov rax, qword ptr [rip + v_41]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_72], rax
+    mov rax, qword ptr [rip + v_45]
+    push rax
+    mov rax, qword ptr [rip + v_86]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_95], rax
+    mov rax, qword ptr [rip + v_75]
+    push rax
+    mov rax, qword ptr [rip + v_25]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_82], rax
+    mov rax, qword ptr [rip + v_70]
+    push rax
+    mov rax, qword ptr [rip + v_6]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_73], rax
+    mov rax, qword ptr [rip + v_26]
+    push rax
+    mov rax, qword ptr [rip + v_15]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_4], rax
+    mov rax, qword ptr [rip + v_67]
+    push rax
+    mov rax, qword ptr [rip + v_61]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_53], rax
+    mov rax, qword ptr [rip + v_37]
+    push rax
+    mov rax, qword ptr [rip + v_5]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_14], rax
+    mov rax, qword ptr [rip + v_45]
+    push rax
+    mov rax, qword ptr [rip + v_12]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_52], rax
+    mov rax, qword ptr [rip + v_40]
+    push rax
+    mov rax, qword ptr [rip + v_24]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_88], rax
+    mov rax, qword ptr [rip + v_81]
+    push rax
+    mov rax, qword ptr [rip + v_26]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_23], rax
+    mov rax, qword ptr [rip + v_89]
+    push rax
+    mov rax, qword ptr [rip + v_92]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_14], rax
+    mov rax, qword ptr [rip + v_81]
+    push rax
+    mov rax, qword ptr [rip + v_24]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_39], rax
+    mov rax, qword ptr [rip + v_22]
+    push rax
+    mov rax, qword ptr [rip + v_49]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_10], rax
+    mov rax, qword ptr [rip + v_41]
+    push rax
+    mov rax, qword ptr [rip + v_60]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_42]
+    push rax
+    mov rax, qword ptr [rip + v_84]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_8], rax
+    mov rax, qword ptr [rip + v_46]
+    push rax
+    mov rax, qword ptr [rip + v_56]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_50], rax
+    mov rax, qword ptr [rip + v_69]
+    push rax
+    mov rax, qword ptr [rip + v_24]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_74], rax
+    mov rax, qword ptr [rip + v_56]
+    push rax
+    mov rax, qword ptr [rip + v_87]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_18], rax
+    mov rax, qword ptr [rip + v_63]
+    push rax
+    mov rax, qword ptr [rip + v_43]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_9], rax
+    mov rax, qword ptr [rip + v_80]
+    push rax
+    mov rax, qword ptr [rip + v_69]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_35], rax
+    mov rax, qword ptr [rip + v_71]
+    push rax
+    mov rax, qword ptr [rip + v_56]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_49], rax
+    mov rax, qword ptr [rip + v_74]
+    push rax
+    mov rax, qword ptr [rip + v_60]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_15], rax
+    mov rax, qword ptr [rip + v_21]
+    push rax
+    mov rax, qword ptr [rip + v_63]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_94], rax
+    mov rax, qword ptr [rip + v_68]
+    push rax
+    mov rax, qword ptr [rip + v_46]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_8], rax
+    mov rax, qword ptr [rip + v_24]
+    push rax
+    mov rax, qword ptr [rip + v_72]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_63], rax
+    mov rax, qword ptr [rip + v_18]
+    push rax
+    mov rax, qword ptr [rip + v_42]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_54], rax
+    mov rax, qword ptr [rip + v_28]
+    push rax
+    mov rax, qword ptr [rip + v_1]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_49], rax
+    mov rax, qword ptr [rip + v_4]
+    push rax
+    mov rax, qword ptr [rip + v_5]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_10], rax
+    mov rax, qword ptr [rip + v_74]
+    push rax
+    mov rax, qword ptr [rip + v_95]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_12], rax
+    mov rax, qword ptr [rip + v_12]
+    push rax
+    mov rax, qword ptr [rip + v_30]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_10], rax
+    mov rax, qword ptr [rip + v_23]
+    push rax
+    mov rax, qword ptr [rip + v_77]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_85], rax
+    mov rax, qword ptr [rip + v_95]
+    push rax
+    mov rax, qword ptr [rip + v_67]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_77], rax
+    mov rax, qword ptr [rip + v_38]
+    push rax
+    mov rax, qword ptr [rip + v_66]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_56]
+    push rax
+    mov rax, qword ptr [rip + v_4]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_79], rax
+    mov rax, qword ptr [rip + v_75]
+    push rax
+    mov rax, qword ptr [rip + v_79]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_91]
+    push rax
+    mov rax, qword ptr [rip + v_50]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_72], rax
+    mov rax, qword ptr [rip + v_43]
+    push rax
+    mov rax, qword ptr [rip + v_45]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_16], rax
+    mov rax, qword ptr [rip + v_10]
+    push rax
+    mov rax, qword ptr [rip + v_10]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_87], rax
+    mov rax, qword ptr [rip + v_72]
+    push rax
+    mov rax, qword ptr [rip + v_17]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_10], rax
+    mov rax, qword ptr [rip + v_61]
+    push rax
+    mov rax, qword ptr [rip + v_68]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_73], rax
+    mov rax, qword ptr [rip + v_32]
+    push rax
+    mov rax, qword ptr [rip + v_10]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_6], rax
+    mov rax, qword ptr [rip + v_72]
+    push rax
+    mov rax, qword ptr [rip + v_47]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_79], rax
+    mov rax, qword ptr [rip + v_71]
+    push rax
+    mov rax, qword ptr [rip + v_23]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_34], rax
+    mov rax, qword ptr [rip + v_88]
+    push rax
+    mov rax, qword ptr [rip + v_82]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_57], rax
+    mov rax, qword ptr [rip + v_58]
+    push rax
+    mov rax, qword ptr [rip + v_8]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_72], rax
+    mov rax, qword ptr [rip + v_11]
+    push rax
+    mov rax, qword ptr [rip + v_27]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_62], rax
+    mov rax, qword ptr [rip + v_42]
+    push rax
+    mov rax, qword ptr [rip + v_35]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_50], rax
+    mov rax, qword ptr [rip + v_57]
+    push rax
+    mov rax, qword ptr [rip + v_26]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_50], rax
+    mov rax, qword ptr [rip + v_92]
+    push rax
+    mov rax, qword ptr [rip + v_84]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_23], rax
+    mov rax, qword ptr [rip + v_59]
+    push rax
+    mov rax, qword ptr [rip + v_83]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_17], rax
+    mov rax, qword ptr [rip + v_70]
+    push rax
+    mov rax, qword ptr [rip + v_52]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_56], rax
+    mov rax, qword ptr [rip + v_64]
+    push rax
+    mov rax, qword ptr [rip + v_19]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_82], rax
+    mov rax, qword ptr [rip + v_24]
+    push rax
+    mov rax, qword ptr [rip + v_44]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_53], rax
+    mov rax, qword ptr [rip + v_85]
+    push rax
+    mov rax, qword ptr [rip + v_33]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_18], rax
+    mov rax, qword ptr [rip + v_55]
+    push rax
+    mov rax, qword ptr [rip + v_2]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_42], rax
+    mov rax, qword ptr [rip + v_93]
+    push rax
+    mov rax, qword ptr [rip + v_83]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_47], rax
+    mov rax, qword ptr [rip + v_79]
+    push rax
+    mov rax, qword ptr [rip + v_89]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_32], rax
+    mov rax, qword ptr [rip + v_65]
+    push rax
+    mov rax, qword ptr [rip + v_39]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_52], rax
+    mov rax, qword ptr [rip + v_30]
+    push rax
+    mov rax, qword ptr [rip + v_64]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_36], rax
+    mov rax, qword ptr [rip + v_42]
+    push rax
+    mov rax, qword ptr [rip + v_27]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_4], rax
+    mov rax, qword ptr [rip + v_33]
+    push rax
+    mov rax, qword ptr [rip + v_8]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_48], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_65]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_44], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_55]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_89], rax
+    mov rax, qword ptr [rip + v_45]
+    push rax
+    mov rax, qword ptr [rip + v_49]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_40], rax
+    mov rax, qword ptr [rip + v_4]
+    push rax
+    mov rax, qword ptr [rip + v_72]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_21], rax
+    mov rax, qword ptr [rip + v_58]
+    push rax
+    mov rax, qword ptr [rip + v_4]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_35], rax
+    mov rax, qword ptr [rip + v_90]
+    push rax
+    mov rax, qword ptr [rip + v_89]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_31], rax
+    mov rax, qword ptr [rip + v_36]
+    push rax
+    mov rax, qword ptr [rip + v_58]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_65], rax
+    mov rax, qword ptr [rip + v_60]
+    push rax
+    mov rax, qword ptr [rip + v_77]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_76], rax
+    mov rax, qword ptr [rip + v_71]
+    push rax
+    mov rax, qword ptr [rip + v_94]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_33], rax
+    mov rax, qword ptr [rip + v_66]
+    push rax
+    mov rax, qword ptr [rip + v_86]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_67], rax
+    mov rax, qword ptr [rip + v_61]
+    push rax
+    mov rax, qword ptr [rip + v_72]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_72], rax
+    mov rax, qword ptr [rip + v_80]
+    push rax
+    mov rax, qword ptr [rip + v_5]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_78], rax
+    mov rax, qword ptr [rip + v_70]
+    push rax
+    mov rax, qword ptr [rip + v_89]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_37], rax
+    mov rax, qword ptr [rip + v_53]
+    push rax
+    mov rax, qword ptr [rip + v_37]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_43], rax
+    mov rax, qword ptr [rip + v_6]
+    push rax
+    mov rax, qword ptr [rip + v_35]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_85], rax
+    mov rax, qword ptr [rip + v_27]
+    push rax
+    mov rax, qword ptr [rip + v_81]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_57], rax
+    mov rax, qword ptr [rip + v_48]
+    push rax
+    mov rax, qword ptr [rip + v_0]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_1], rax
+    mov rax, qword ptr [rip + v_18]
+    push rax
+    mov rax, qword ptr [rip + v_21]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_24], rax
+    mov rax, qword ptr [rip + v_63]
+    push rax
+    mov rax, qword ptr [rip + v_7]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_9], rax
+    mov rax, qword ptr [rip + v_41]
+    push rax
+    mov rax, qword ptr [rip + v_26]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_47], rax
+    mov rax, qword ptr [rip + v_48]
+    push rax
+    mov rax, qword ptr [rip + v_85]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_54], rax
+    mov rax, qword ptr [rip + v_38]
+    push rax
+    mov rax, qword ptr [rip + v_42]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_9], rax
+    mov rax, qword ptr [rip + v_5]
+    push rax
+    mov rax, qword ptr [rip + v_46]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_58], rax
+    mov rax, qword ptr [rip + v_63]
+    push rax
+    mov rax, qword ptr [rip + v_46]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_43], rax
+    mov rax, qword ptr [rip + v_94]
+    push rax
+    mov rax, qword ptr [rip + v_75]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_34], rax
+    mov rax, qword ptr [rip + v_0]
+    push rax
+    mov rax, qword ptr [rip + v_81]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_23], rax
+    mov rax, qword ptr [rip + v_76]
+    push rax
+    mov rax, qword ptr [rip + v_11]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_57], rax
+    mov rax, qword ptr [rip + v_59]
+    push rax
+    mov rax, qword ptr [rip + v_52]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_28], rax
+    mov rax, qword ptr [rip + v_67]
+    push rax
+    mov rax, qword ptr [rip + v_14]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_78], rax
+    mov rax, qword ptr [rip + v_50]
+    push rax
+    mov rax, qword ptr [rip + v_20]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_74], rax
+    mov rax, qword ptr [rip + v_29]
+    push rax
+    mov rax, qword ptr [rip + v_59]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_33], rax
+    mov rax, qword ptr [rip + v_47]
+    push rax
+    mov rax, qword ptr [rip + v_90]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_69], rax
+    mov rax, qword ptr [rip + v_92]
+    push rax
+    mov rax, qword ptr [rip + v_46]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_27], rax
+    mov rax, qword ptr [rip + v_73]
+    push rax
+    mov rax, qword ptr [rip + v_69]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_36], rax
+    mov rax, qword ptr [rip + v_12]
+    push rax
+    mov rax, qword ptr [rip + v_48]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_84], rax
+    mov rax, qword ptr [rip + v_31]
+    push rax
+    mov rax, qword ptr [rip + v_39]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_70], rax
+    mov rax, qword ptr [rip + v_79]
+    push rax
+    mov rax, qword ptr [rip + v_57]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_29], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_84]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_89], rax
+    mov rax, qword ptr [rip + v_83]
+    push rax
+    mov rax, qword ptr [rip + v_32]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_19], rax
+    mov rax, qword ptr [rip + v_66]
+    push rax
+    mov rax, qword ptr [rip + v_29]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_20], rax
+    mov rax, qword ptr [rip + v_59]
+    push rax
+    mov rax, qword ptr [rip + v_81]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_5], rax
+    mov rax, qword ptr [rip + v_46]
+    push rax
+    mov rax, qword ptr [rip + v_94]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_29], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_80]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_40], rax
+    mov rax, qword ptr [rip + v_29]
+    push rax
+    mov rax, qword ptr [rip + v_52]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_20], rax
+    mov rax, qword ptr [rip + v_87]
+    push rax
+    mov rax, qword ptr [rip + v_71]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_8], rax
+    mov rax, qword ptr [rip + v_94]
+    push rax
+    mov rax, qword ptr [rip + v_3]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_64], rax
+    mov rax, qword ptr [rip + v_53]
+    push rax
+    mov rax, qword ptr [rip + v_35]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_68], rax
+    mov rax, qword ptr [rip + v_33]
+    push rax
+    mov rax, qword ptr [rip + v_42]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_66], rax
+    mov rax, qword ptr [rip + v_64]
+    push rax
+    mov rax, qword ptr [rip + v_33]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_65], rax
+    mov rax, qword ptr [rip + v_80]
+    push rax
+    mov rax, qword ptr [rip + v_81]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_77], rax
+    mov rax, qword ptr [rip + v_75]
+    push rax
+    mov rax, qword ptr [rip + v_17]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_21], rax
+    mov rax, qword ptr [rip + v_55]
+    push rax
+    mov rax, qword ptr [rip + v_4]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_38], rax
+    mov rax, qword ptr [rip + v_91]
+    push rax
+    mov rax, qword ptr [rip + v_24]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_94], rax
+    mov rax, qword ptr [rip + v_44]
+    push rax
+    mov rax, qword ptr [rip + v_80]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_71], rax
+    mov rax, qword ptr [rip + v_75]
+    push rax
+    mov rax, qword ptr [rip + v_82]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_87], rax
+    mov rax, qword ptr [rip + v_2]
+    push rax
+    mov rax, qword ptr [rip + v_61]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_95], rax
+    mov rax, qword ptr [rip + v_64]
+    push rax
+    mov rax, qword ptr [rip + v_37]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_25], rax
+    mov rax, qword ptr [rip + v_62]
+    push rax
+    mov rax, qword ptr [rip + v_68]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_36], rax
+    mov rax, qword ptr [rip + v_79]
+    push rax
+    mov rax, qword ptr [rip + v_74]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_35], rax
+    mov rax, qword ptr [rip + v_28]
+    push rax
+    mov rax, qword ptr [rip + v_29]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 4
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_38], rax
+    mov rax, qword ptr [rip + v_10]
+    push rax
+    mov rax, qword ptr [rip + v_52]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_82], rax
+    mov rax, qword ptr [rip + v_15]
+    push rax
+    mov rax, qword ptr [rip + v_18]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_56], rax
+    mov rax, qword ptr [rip + v_82]
+    push rax
+    mov rax, qword ptr [rip + v_87]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_42], rax
+    mov rax, qword ptr [rip + v_40]
+    push rax
+    mov rax, qword ptr [rip + v_36]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_87], rax
+    mov rax, qword ptr [rip + v_17]
+    push rax
+    mov rax, qword ptr [rip + v_7]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_82], rax
+    mov rax, qword ptr [rip + v_37]
+    push rax
+    mov rax, qword ptr [rip + v_68]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_17], rax
+    mov rax, qword ptr [rip + v_60]
+    push rax
+    mov rax, qword ptr [rip + v_77]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_68], rax
+    mov rax, qword ptr [rip + v_40]
+    push rax
+    mov rax, qword ptr [rip + v_85]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_48], rax
+    mov rax, qword ptr [rip + v_5]
+    push rax
+    mov rax, qword ptr [rip + v_60]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_34], rax
+    mov rax, qword ptr [rip + v_22]
+    push rax
+    mov rax, qword ptr [rip + v_16]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_32], rax
+    mov rax, qword ptr [rip + v_7]
+    push rax
+    mov rax, qword ptr [rip + v_17]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_18], rax
+    mov rax, qword ptr [rip + v_66]
+    push rax
+    mov rax, qword ptr [rip + v_60]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_66], rax
+    mov rax, qword ptr [rip + v_75]
+    push rax
+    mov rax, qword ptr [rip + v_73]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_44], rax
+    mov rax, qword ptr [rip + v_75]
+    push rax
+    mov rax, qword ptr [rip + v_19]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_45], rax
+    mov rax, qword ptr [rip + v_90]
+    push rax
+    mov rax, qword ptr [rip + v_23]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_79], rax
+    mov rax, qword ptr [rip + v_19]
+    push rax
+    mov rax, qword ptr [rip + v_25]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_52], rax
+    mov rax, qword ptr [rip + v_43]
+    push rax
+    mov rax, qword ptr [rip + v_29]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_87], rax
+    mov rax, qword ptr [rip + v_71]
+    push rax
+    mov rax, qword ptr [rip + v_71]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_52], rax
+    mov rax, qword ptr [rip + v_87]
+    push rax
+    mov rax, qword ptr [rip + v_11]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_80], rax
+    mov rax, qword ptr [rip + v_26]
+    push rax
+    mov rax, qword ptr [rip + v_64]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_35], rax
+    mov rax, qword ptr [rip + v_27]
+    push rax
+    mov rax, qword ptr [rip + v_23]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_40], rax
+    mov rax, qword ptr [rip + v_54]
+    push rax
+    mov rax, qword ptr [rip + v_51]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_75], rax
+    mov rax, qword ptr [rip + v_26]
+    push rax
+    mov rax, qword ptr [rip + v_79]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_51], rax
+    mov rax, qword ptr [rip + v_71]
+    push rax
+    mov rax, qword ptr [rip + v_93]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_38], rax
+    mov rax, qword ptr [rip + v_11]
+    push rax
+    mov rax, qword ptr [rip + v_25]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_95], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_68]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_46], rax
+    mov rax, qword ptr [rip + v_29]
+    push rax
+    mov rax, qword ptr [rip + v_35]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_52], rax
+    mov rax, qword ptr [rip + v_48]
+    push rax
+    mov rax, qword ptr [rip + v_74]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_39], rax
+    mov rax, qword ptr [rip + v_68]
+    push rax
+    mov rax, qword ptr [rip + v_15]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_20], rax
+    mov rax, qword ptr [rip + v_45]
+    push rax
+    mov rax, qword ptr [rip + v_83]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_0], rax
+    mov rax, qword ptr [rip + v_92]
+    push rax
+    mov rax, qword ptr [rip + v_70]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_31], rax
+    mov rax, qword ptr [rip + v_32]
+    push rax
+    mov rax, qword ptr [rip + v_63]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_66], rax
+    mov rax, qword ptr [rip + v_69]
+    push rax
+    mov rax, qword ptr [rip + v_59]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_31], rax
+    mov rax, qword ptr [rip + v_56]
+    push rax
+    mov rax, qword ptr [rip + v_72]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_75], rax
+    mov rax, qword ptr [rip + v_3]
+    push rax
+    mov rax, qword ptr [rip + v_19]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_82], rax
+    mov rax, qword ptr [rip + v_85]
+    push rax
+    mov rax, qword ptr [rip + v_67]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_70], rax
+    mov rax, qword ptr [rip + v_17]
+    push rax
+    mov rax, qword ptr [rip + v_65]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_40], rax
+    mov rax, qword ptr [rip + v_35]
+    push rax
+    mov rax, qword ptr [rip + v_75]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_10], rax
+    mov rax, qword ptr [rip + v_32]
+    push rax
+    mov rax, qword ptr [rip + v_15]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_21], rax
+    mov rax, qword ptr [rip + v_24]
+    push rax
+    mov rax, qword ptr [rip + v_62]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_34], rax
+    mov rax, qword ptr [rip + v_19]
+    push rax
+    mov rax, qword ptr [rip + v_78]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_38], rax
+    mov rax, qword ptr [rip + v_66]
+    push rax
+    mov rax, qword ptr [rip + v_18]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 7
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_35], rax
+    mov rax, qword ptr [rip + v_68]
+    push rax
+    mov rax, qword ptr [rip + v_69]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_47], rax
+    mov rax, qword ptr [rip + v_45]
+    push rax
+    mov rax, qword ptr [rip + v_83]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 2
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_58], rax
+    mov rax, qword ptr [rip + v_52]
+    push rax
+    mov rax, qword ptr [rip + v_64]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_64], rax
+    mov rax, qword ptr [rip + v_23]
+    push rax
+    mov rax, qword ptr [rip + v_52]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_79], rax
+    mov rax, qword ptr [rip + v_93]
+    push rax
+    mov rax, qword ptr [rip + v_20]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 1
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_15], rax
+    mov rax, qword ptr [rip + v_38]
+    push rax
+    mov rax, qword ptr [rip + v_22]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 6
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_56], rax
+    mov rax, qword ptr [rip + v_15]
+    push rax
+    mov rax, qword ptr [rip + v_26]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 9
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_50], rax
+    mov rax, qword ptr [rip + v_73]
+    push rax
+    mov rax, qword ptr [rip + v_64]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 5
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_49], rax
+    mov rax, qword ptr [rip + v_12]
+    push rax
+    mov rax, qword ptr [rip + v_64]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 3
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_2], rax
+    mov rax, qword ptr [rip + v_51]
+    push rax
+    mov rax, qword ptr [rip + v_93]
+    pop rbx
+    add rax, rbx
+    push rax
+    mov rax, 8
+    pop rbx
+    mov rcx, rbx
+    sub rcx, rax
+    mov rax, rcx
+    mov qword ptr [rip + v_60], rax
+    lfence
+    rdtsc
+    shl rdx, 32
+    or rax, rdx
+    sub rax, qword ptr [rip + lsys_bench_tsc]
+    mov qword ptr [rip + lsys_bench_tsc], rax
+    mov rax, 1
+    mov rdi, 3
+    lea rsi, [rip + lsys_bench_tsc]
+    mov rdx, 8
+    syscall
+    mov rax, 60
+    xor rdi, rdi
+    syscall
+.section .data
+lsys_bench_tsc:
+    .quad 0
@@ -5,16 +5,124 @@
 #include "scope.h"
 #include <stddef.h>
 
+#define EMIT_MAX_THREADS 64
+#define EMIT_MAX_PARAMS 6       /* arguments travel in registers only */
+#define EMIT_INLINE_BUDGET 16   /* max expression nodes an inlined call may expand to */
+#define EMIT_SINK_CHUNK (64u << 10) /* output handed to a sink in chunks of about this size */
+
+/* profile file = contents of the .lsys_prof section of an instrumented program:
+   magic, program fingerprint, statement count, then one u64 counter per statement */
+#define LSYS_PROF_MAGIC 0x314652505359534cULL   /* "LSYSPRF1" */
+#define LSYS_PROF_MAGIC_STR "0x314652505359534c"
+#define LSYS_PROF_HEADER 24
+
+/* growable output buffer, used instead of out_fd by parallel workers */
+typedef struct {
+    char* data;
+    size_t len;
+    size_t cap;
+} emit_buf_t;
+
+typedef struct emit_func emit_func_t;
+typedef struct emit_inline emit_inline_t;
+typedef struct emit_rewrite emit_rewrite_t;
+
 /* emitter context */
 typedef struct {
     int out_fd;
     scope_t* scope;
     void* (*alloc)(size_t);
     void (*free_fn)(void*);
+    emit_buf_t* buf;   /* when set, output is appended here instead of out_fd */
+    int out_failed;    /* some output was dropped (buffer allocation or write failed) */
+    int nthreads;      /* >1: statements are emitted by worker threads */
+    size_t nstmts;     /* top-level statements in the program being emitted */
+
+    /* profile-guided optimization */
+    const char* prof_out;  /* instrument: counters are dumped here at exit */
+    const void* prof_in;   /* profile consumed for promotion and data layout */
+    size_t prof_in_len;
+    size_t* data_order;    /* .data slot order (scope indices), NULL = scope order */
+    char prof_fp_str[20];
+
+    /* functions */
+    emit_func_t* funcs;    /* definitions, first one wins per name */
+    size_t nfuncs;
+    size_t funcs_cap;
+    emit_inline_t* inl;    /* call currently being inlined, NULL otherwise */
+    size_t nglobal_targets; /* scope entries [0, n) are assigned at top level */
+
+    /* first error found while registering the program, NULL if none */
+    const char* error;
+    const char* error_name;    /* function it is about */
+    size_t error_name_len;
+
+    /* output sink, NULL = write(2) straight to out_fd */
+    void (*sink)(void* ctx, char* data, size_t len);
+    void* sink_ctx;
+    emit_buf_t sink_buf;   /* staged output not yet handed over */
+
+    /* superoptimizer rewrite db (see superopt.h), open addressing by key hash */
+    emit_rewrite_t* rw;
+    size_t rw_cap;
 } emitter_t;
 
 void emitter_init(emitter_t* e, int out_fd, scope_t* scope, void* (*alloc)(size_t), void (*free_fn)(void*));
-int emitter_emit_program(emitter_t* e, ast_node_t* prog); /* returns 0 on success */
+/* output is byte-identical to the single-threaded emitter for any thread count,
+   unless e->out_failed ends up set */
+void emitter_set_threads(emitter_t* e, int nthreads);
+/* make the program count statement executions and write them to profile_path on exit */
+void emitter_instrument(emitter_t* e, const char* profile_path);
+/* use counters from an instrumented run; ignored with a warning if they do not match */
+void emitter_use_profile(emitter_t* e, const void* data, size_t len);
+/* lower expression trees found in a rewrite db with its sequences;
+   data (the db file contents) must outlive the emitter */
+void emitter_use_rewrites(emitter_t* e, const char* data, size_t len);
+/* returns 0 on success, -1 with e->error set when the program is rejected
+   (nothing is emitted then) */
+int emitter_emit_program(emitter_t* e, ast_node_t* prog);
+/* the same in two steps, for drivers that open the output only once the
+   program is known to be accepted: prepare never writes output */
+int emitter_prepare_program(emitter_t* e, ast_node_t* prog);
+void emitter_emit_prepared(emitter_t* e, ast_node_t* prog);
+
+/* pieces of emitter_emit_program for drivers that assemble the output
+   themselves (incremental mode); the scope must already hold every variable */
+void emitter_emit_preamble(emitter_t* e);
+void emitter_emit_stmts(emitter_t* e, ast_node_t* first, emit_buf_t* out);
+void emitter_emit_epilogue(emitter_t* e);
+/* register the function definitions in a statement list (done by
+   emitter_emit_program itself), and emit their bodies.
+   scoping: a function's locals are its parameters and the names it assigns,
+   except names also assigned at top level, which stay globals (as in C). a
+   name assigned only inside functions is thus local to each of them, and
+   reading it anywhere else reads a separate global that stays 0 */
+void emitter_add_funcs(emitter_t* e, ast_node_t* stmts);
+void emitter_emit_funcs(emitter_t* e, ast_node_t* first, emit_buf_t* out);
+/* once every function is registered: reject calls to unknown functions,
+   calls with the wrong argument count and top-level returns (sets e->error,
+   as emitter_add_funcs does for duplicate or oversized definitions) */
+void emitter_check_stmts(emitter_t* e, ast_node_t* stmts);
+/* once every function is registered: warn on stderr about globals that are
+   read but only ever assigned inside functions (see scoping above) */
+void emitter_check_globals(emitter_t* e);
+
+/* visit the globals a statement assigns / reads, in the order
+   emitter_emit_program registers them: targets of every statement, then
+   emitter_targets_done, then reads of every statement */
+void emitter_stmt_targets(ast_node_t* stmt, void (*fn)(void* ctx, const char* name, size_t len), void* ctx);
+void emitter_targets_done(emitter_t* e);
+void emitter_stmt_reads(emitter_t* e, ast_node_t* stmt, void (*fn)(void* ctx, const char* name, size_t len), void* ctx);
+
+/* send output to sink instead of out_fd: it receives chunks allocated with
+   the emitter allocator and frees them once written. emitter_close hands over
+   the last one */
+void emitter_set_sink(emitter_t* e, void (*sink)(void* ctx, char* data, size_t len), void* ctx);
+/* raw output to the sink or out_fd, for callers assembling pieces themselves */
+void emitter_write(emitter_t* e, const char* data, size_t len);
+/* append to an in-memory buffer, growing it through the emitter allocator */
+void emitter_buf_write(emitter_t* e, emit_buf_t* b, const void* data, size_t len);
+
 void emitter_close(emitter_t* e);
 
 #endif
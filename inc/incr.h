@@ -0,0 +1,30 @@
+#ifndef INCR_H
+#define INCR_H
+
+#include "emit.h"
+#include <stddef.h>
+
+/* incremental compilation.
+   the source is cut into segments after every ';' outside braces and after
+   the '}' closing each function body (the parser always starts fresh
+   there), and the cache file keeps, per segment, a hash of its text, the
+   variables it assigns and reads, and the code emitted for it. on the
+   next compile only segments whose hash is not in the cache are lexed,
+   parsed and emitted; the rest reuse cached code as long as the variable
+   order (and so every v_N label) and the function definitions are unchanged.
+   segments defining functions are always recompiled. output is identical to
+   a full compile. */
+
+#define INCR_MAGIC 0x32434e495359534cULL   /* "LSYSINC2" */
+
+typedef struct incr incr_t;
+
+/* parse, register and check src through e (scope must be empty) against
+   cache_path, without writing anything. returns NULL if the program cannot
+   be compiled, with e->error set when it is rejected */
+incr_t* incr_prepare(emitter_t* e, char* src, size_t src_len, const char* cache_path);
+/* emit what incr_prepare accepted and refresh the cache; frees st.
+   returns 0 on success */
+int incr_emit(incr_t* st);
+
+#endif
@@ -4,10 +4,33 @@
 #include <stddef.h>
 #include <stdint.h>
 
+/* subsystem an allocation is charged to when tracing (LMEM_TRACE) */
+typedef enum {
+    LMEM_TAG_MISC,
+    LMEM_TAG_PARSER,       /* ast nodes */
+    LMEM_TAG_SCOPE_NAME,   /* identifier copies */
+    LMEM_TAG_SCOPE_LABEL,  /* v_N label strings */
+    LMEM_TAG_SCOPE_TABLE,  /* symbol entry arrays */
+    LMEM_TAG_EMIT,         /* emitter buffers and bookkeeping */
+    LMEM_TAG_THREAD_STACK, /* worker thread stacks */
+    LMEM_TAG_COUNT
+} lmem_tag_t;
+
 void* lmalloc(size_t sz);
 void lfree(void* ptr);
 void* lrealloc(void* ptr, size_t new_sz);
 void lmemset(void* ptr, uint8_t value, size_t sz);
 
+#ifdef LMEM_TRACE
+/* set the tag charged for following allocations, returns the previous one.
+   the tag is process-wide: change it from the main thread only */
+lmem_tag_t lmem_set_tag(lmem_tag_t tag);
+/* write the heap profile (per-tag counts, live/peak bytes, size histograms,
+   blocks still live, bad frees) to fd */
+void lmem_report(int fd);
+#else
+static inline lmem_tag_t lmem_set_tag(lmem_tag_t tag) { (void)tag; return LMEM_TAG_MISC; }
+static inline void lmem_report(int fd) { (void)fd; }
 #endif
 
+#endif
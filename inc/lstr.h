@@ -2,6 +2,9 @@
 #define LSTR_H
 
 #include <stddef.h>
+#include <stdint.h>
+
+#define LFNV_OFFSET 0xcbf29ce484222325ULL
 
 size_t lstrlen(const char* s);
 int lstrcmp(const char* a, const char* b);
@@ -9,6 +12,11 @@ int lstrncmp(const char* a, const char* b, size_t len);
 void lstrcpy(char* dest, const char* src);
 void lstrcat(char* dest, const char* src);
 void litoa(int value, char* buf);
+int latoi(const char* s);
+/* 64-bit FNV-1a over len bytes, continuing from h (start with LFNV_OFFSET) */
+uint64_t lfnv1a(uint64_t h, const void* data, size_t len);
+/* write all len bytes to fd, retrying short writes; returns 0, or -1 after an error */
+int lwrite_all(int fd, const char* buf, size_t len);
 
 #endif
 
@@ -0,0 +1,23 @@
+#ifndef LTHREAD_H
+#define LTHREAD_H
+
+#include <stddef.h>
+
+#define LTHREAD_STACK_SIZE (8u << 20)
+
+/* minimal clone()-based thread, no libc involved */
+typedef struct {
+    void* stack;
+    volatile int tid;   /* set at spawn, cleared by the kernel on thread exit */
+} lthread_t;
+
+/* get the thread's stack from alloc; returns 0 on success */
+int lthread_alloc(lthread_t* t, void* (*alloc)(size_t));
+/* start fn(arg) on the allocated stack; returns 0 on success */
+int lthread_start(lthread_t* t, int (*fn)(void*), void* arg);
+/* wait for the thread (if started) to exit and release its stack */
+void lthread_join(lthread_t* t, void (*free_fn)(void*));
+/* number of cpus this process may run on (at least 1) */
+int lthread_ncpus(void);
+
+#endif
@@ -0,0 +1,79 @@
+#ifndef LURING_H
+#define LURING_H
+
+#include <linux/io_uring.h>
+#include <linux/stat.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define LURING_ENTRIES 64
+
+/* minimal io_uring on the raw syscalls, no liburing */
+typedef struct {
+    int fd;
+    /* submission ring; sq_array maps slot i to sqe i once at setup */
+    volatile unsigned* sq_head;
+    volatile unsigned* sq_tail;
+    unsigned sq_mask;
+    unsigned sq_entries;
+    struct io_uring_sqe* sqes;
+    unsigned sq_local_tail;    /* sqes filled but not yet published */
+    unsigned sq_submitted;     /* published tail not yet passed to the kernel */
+    /* completion ring */
+    volatile unsigned* cq_head;
+    volatile unsigned* cq_tail;
+    unsigned cq_mask;
+    struct io_uring_cqe* cqes;
+
+    void* sq_map;
+    size_t sq_map_len;
+    void* cq_map;              /* == sq_map with IORING_FEAT_SINGLE_MMAP */
+    size_t cq_map_len;
+    size_t sqe_map_len;
+} luring_t;
+
+/* set up a ring; returns 0, or a negative errno when io_uring is unavailable */
+int luring_init(luring_t* r, unsigned entries);
+void luring_close(luring_t* r);
+
+/* next sqe, zeroed; NULL while the submission ring is full */
+struct io_uring_sqe* luring_sqe(luring_t* r);
+/* pass queued sqes to the kernel and wait for wait_nr completions */
+int luring_submit(luring_t* r, unsigned wait_nr);
+/* reap one completion: luring_peek returns 0 when none is ready,
+   luring_wait blocks for one. both return 1 with user_data and res filled */
+int luring_peek(luring_t* r, uint64_t* user_data, int32_t* res);
+int luring_wait(luring_t* r, uint64_t* user_data, int32_t* res);
+
+void luring_prep_openat(struct io_uring_sqe* sqe, int dfd, const char* path, int flags, unsigned mode);
+void luring_prep_statx(struct io_uring_sqe* sqe, int dfd, const char* path, int flags, unsigned mask, struct statx* out);
+void luring_prep_read(struct io_uring_sqe* sqe, int fd, void* buf, unsigned len, uint64_t off);
+void luring_prep_write(struct io_uring_sqe* sqe, int fd, const void* buf, unsigned len, uint64_t off);
+void luring_prep_close(struct io_uring_sqe* sqe, int fd);
+
+/* driver I/O: open and statx in_path in one linked batch, then read all of
+   it into a buffer from alloc. returns 0, or -1 with nothing left open */
+int luring_read_file(luring_t* r, const char* in_path, void* (*alloc)(size_t), void (*free_fn)(void*),
+                     char** src, size_t* src_len);
+/* create (or truncate) path for writing; returns the fd, or a negative value.
+   the driver calls it only once the program has been accepted */
+int luring_create(luring_t* r, const char* path);
+
+/* output writer fed chunk by chunk (emitter sink): each chunk is written at
+   the next file offset as soon as it arrives and freed once written */
+typedef struct {
+    luring_t* ring;
+    int fd;
+    uint64_t off;
+    unsigned inflight;
+    int failed;
+    void* (*alloc)(size_t);
+    void (*free_fn)(void*);
+} luring_writer_t;
+
+void luring_writer_init(luring_writer_t* w, luring_t* r, int fd, void* (*alloc)(size_t), void (*free_fn)(void*));
+void luring_writer_sink(void* ctx, char* data, size_t len);
+/* wait for every write, then close the fd; returns 0 if all data landed */
+int luring_writer_finish(luring_writer_t* w);
+
+#endif
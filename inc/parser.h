@@ -10,7 +10,10 @@ typedef enum {
     NODE_ASSIGN,    // var = expr
     NODE_INT,       // integer literal
     NODE_VAR,       // identifier
-    NODE_BINOP      // left op right
+    NODE_BINOP,     // left op right
+    NODE_FUNC,      // fn name(params) { body }: left = params (NODE_VAR via next), right = body
+    NODE_CALL,      // name(args): left = args chained via next
+    NODE_RETURN     // return expr: left = expr (may be NULL)
 } node_type_t;
 
 typedef enum {
@@ -28,7 +31,7 @@ typedef struct ast_node {
     /* for int */
     int int_value;
 
-    /* for binop */
+    /* for binop (left/right are reused as lists by func and call, see node_type_t) */
     binop_type_t op;
     struct ast_node* left;
     struct ast_node* right;
@@ -38,11 +41,14 @@ typedef struct {
     lexer_t* lex;
     token_t cur;
     void* (*alloc)(size_t);  // allocator (from lmem)
+    void (*free_fn)(void*);  // releases nodes dropped by error recovery
+    const char* error;       // first error that makes the program unusable, NULL if none
 } parser_t;
 
-void parser_init(parser_t* p, lexer_t* lex, void* (*alloc_fn)(size_t));
+void parser_init(parser_t* p, lexer_t* lex, void* (*alloc_fn)(size_t), void (*free_fn)(void*));
 ast_node_t* parser_parse_program(parser_t* p);    // returns linked list (NODE_PROGRAM -> statements)
-void parser_free_ast(parser_t* p, ast_node_t* root); // frees using p->alloc? (noop for now)
+void parser_free_ast(parser_t* p, ast_node_t* root); // frees root, its children and siblings with p->free_fn
+void ast_free(ast_node_t* root, void (*free_fn)(void*)); // same, for callers without the parser
 
 #endif
 
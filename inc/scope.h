@@ -9,7 +9,9 @@ typedef struct scope scope_t;
 typedef struct {
     char* name;      /* nul-terminated copy owned by scope */
     size_t name_len;
-    char* label;     /* nul-terminated label string like "v_0" */
+    char* label;     /* nul-terminated label string like "v_0"; NULL for function locals */
+    const char* reg; /* register the variable lives in, NULL when in memory */
+    size_t slot;     /* function locals: frame slot, at [rbp - 8 * (slot + 1)] */
 } sym_entry_t;
 
 /* opaque scope type */
@@ -20,14 +22,29 @@ struct scope {
     void* (*alloc)(size_t);
     void (*free_fn)(void*);
     size_t next_id;       /* used to generate labels v_0, v_1, ... */
+    scope_t* parent;      /* enclosing scope for function locals, NULL for globals */
+    int frozen;           /* no more entries: lookups are read-only and thread-safe */
 };
 
 /* initialize scope context */
 void scope_init(scope_t* s, void* (*alloc)(size_t), void (*free_fn)(void*));
 
-/* lookup or create variable label; returns pointer to label string owned by scope */
+/* nested scope for a function body; entries get frame slots instead of labels */
+void scope_init_nested(scope_t* s, scope_t* parent);
+
+/* lookup or create variable label; returns pointer to label string owned by scope.
+   once frozen, unknown names return NULL instead of being created */
 char* scope_get_label(scope_t* s, const char* name, size_t name_len);
 
+/* same as scope_get_label but returns the whole entry */
+sym_entry_t* scope_get_entry(scope_t* s, const char* name, size_t name_len);
+
+/* lookup through s and its parents without creating anything */
+sym_entry_t* scope_find(scope_t* s, const char* name, size_t name_len);
+
+/* stop creating entries so concurrent readers can share the scope */
+void scope_freeze(scope_t* s);
+
 /* iterate entries (start index) */
 sym_entry_t* scope_entry_at(scope_t* s, size_t idx);
 
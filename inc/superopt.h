@@ -0,0 +1,38 @@
+#ifndef SUPEROPT_H
+#define SUPEROPT_H
+
+#include "parser.h"
+#include <stddef.h>
+
+/* superoptimizer for small expression trees.
+   eligible trees are add/sub/mul NODE_BINOPs over integer constants and at
+   most two distinct variables (at least one). the offline pass (lsysc
+   --superopt) enumerates every sequence of up to SUPEROPT_MAX_LEN
+   instructions over mov/add/sub/imul/lea/shl/neg on rax, rcx, rdx and keeps
+   the shortest one computing the tree (the empty one for identities),
+   provided it beats the stack-machine lowering of emit_expr. candidates
+   pass random test vectors first and are then proven: every instruction is
+   a polynomial operation mod 2^64, and two such polynomials of degree <= d
+   in each variable agree everywhere iff they agree on the {0..d}^2 grid
+   (their Newton coefficients are integer combinations of the grid values).
+
+   rewrite db: text, one "key<TAB>insn; insn; ..." line per tree, '#' starts a
+   comment line. the key is the tree in prefix form with variables renamed x
+   and y in order of first appearance, e.g. "(+ (* x x) 3)". sequences take x
+   in rax and y in rcx, leave the result in rax and may clobber rdx; an empty
+   sequence means the tree is just x */
+
+#define SUPEROPT_MAX_LEN 3
+#define SUPEROPT_MAX_NODES 9
+#define SUPEROPT_KEY_MAX 256
+
+/* key of an eligible tree into out (nul-terminated), its variables (first
+   appearance order) into vars; returns the key length, or 0 if the tree is
+   not eligible or the key does not fit */
+size_t superopt_key(ast_node_t* expr, char* out, size_t cap, ast_node_t* vars[2]);
+
+/* search every eligible tree in the program (function bodies included) and
+   write the rewrite db to out_fd; returns the number of rewrites found */
+int superopt_run(ast_node_t* prog, int out_fd, void* (*alloc)(size_t), void (*free_fn)(void*));
+
+#endif
@@ -4,30 +4,68 @@
 #include "scope.h"
 #include "parser.h"   // provides ast_node_t
 #include "lmem.h"
+#include "lthread.h"
+#include "superopt.h"
 
 #include <unistd.h>
 #include <stddef.h>
 #include <stdint.h>
+#include <sys/uio.h>
 
-/* --- robust write helpers --- */
-static void fd_write_all(int fd, const char* buf, size_t len) {
-    size_t off = 0;
-    while (off < len) {
-        ssize_t wr = write(fd, buf + off, len - off);
-        if (wr <= 0) return; /* give up on error (freestanding) */
-        off += (size_t)wr;
+/* --- output buffers --- */
+void emitter_buf_write(emitter_t* e, emit_buf_t* b, const void* data, size_t len) {
+    const char* s = (const char*) data;
+    if (b->len + len > b->cap) {
+        size_t newcap = b->cap ? b->cap * 2 : 4096;
+        while (newcap < b->len + len) newcap *= 2;
+        char* nd = (char*) e->alloc(newcap);
+        if (!nd) { e->out_failed = 1; return; }
+        for (size_t i = 0; i < b->len; ++i) nd[i] = b->data[i];
+        if (b->data) e->free_fn(b->data);
+        b->data = nd;
+        b->cap = newcap;
     }
+    for (size_t i = 0; i < len; ++i) b->data[b->len + i] = s[i];
+    b->len += len;
 }
 
-static void fd_writes(int fd, const char* s) {
-    fd_write_all(fd, s, lstrlen(s));
+/* hand the staged output to the sink, which now owns it */
+static void sink_flush(emitter_t* e) {
+    if (!e->sink_buf.len) return;
+    e->sink(e->sink_ctx, e->sink_buf.data, e->sink_buf.len);
+    e->sink_buf.data = NULL;
+    e->sink_buf.len = 0;
+    e->sink_buf.cap = 0;
+}
+
+/* stage output, handing the chunk over once the next piece would not fit */
+static void sink_write(emitter_t* e, const char* s, size_t len) {
+    if (e->sink_buf.len + len > e->sink_buf.cap) sink_flush(e);
+    if (!e->sink_buf.data) {
+        size_t cap = len > EMIT_SINK_CHUNK ? len : EMIT_SINK_CHUNK;
+        e->sink_buf.data = (char*) e->alloc(cap);
+        e->sink_buf.cap = e->sink_buf.data ? cap : 0;
+    }
+    emitter_buf_write(e, &e->sink_buf, s, len);
+}
+
+/* route output to the private buffer when one is attached, else to the sink
+   or the fd */
+static void out_write(emitter_t* e, const char* s, size_t len) {
+    if (e->buf) emitter_buf_write(e, e->buf, s, len);
+    else if (e->sink) sink_write(e, s, len);
+    else if (lwrite_all(e->out_fd, s, len) != 0) e->out_failed = 1;
+}
+
+static void out_writes(emitter_t* e, const char* s) {
+    out_write(e, s, lstrlen(s));
 }
 
 /* write three pieces in sequence (convenience) */
-static void fd_writes3(int fd, const char* a, const char* b, const char* c) {
-    fd_writes(fd, a);
-    fd_writes(fd, b);
-    fd_writes(fd, c);
+static void out_writes3(emitter_t* e, const char* a, const char* b, const char* c) {
+    out_writes(e, a);
+    out_writes(e, b);
+    out_writes(e, c);
 }
 
 /* integer -> ascii helper (uses your litoa) */
@@ -39,56 +77,309 @@ void emitter_init(emitter_t* e, int out_fd, scope_t* scope, void* (*alloc)(size_
     e->scope = scope;
     e->alloc = alloc;
     e->free_fn = free_fn;
+    e->buf = NULL;
+    e->out_failed = 0;
+    e->nthreads = 1;
+    e->nstmts = 0;
+    e->prof_out = NULL;
+    e->prof_in = NULL;
+    e->prof_in_len = 0;
+    e->data_order = NULL;
+    e->funcs = NULL;
+    e->nfuncs = 0;
+    e->funcs_cap = 0;
+    e->inl = NULL;
+    e->nglobal_targets = 0;
+    e->error = NULL;
+    e->error_name = NULL;
+    e->error_name_len = 0;
+    e->sink = NULL;
+    e->sink_ctx = NULL;
+    e->sink_buf.data = NULL;
+    e->sink_buf.len = 0;
+    e->sink_buf.cap = 0;
+    e->rw = NULL;
+    e->rw_cap = 0;
+}
+
+void emitter_set_sink(emitter_t* e, void (*sink)(void* ctx, char* data, size_t len), void* ctx) {
+    e->sink = sink;
+    e->sink_ctx = ctx;
+}
+
+void emitter_write(emitter_t* e, const char* data, size_t len) {
+    if (e->sink) sink_write(e, data, len);
+    else if (lwrite_all(e->out_fd, data, len) != 0) e->out_failed = 1;
+}
+
+void emitter_set_threads(emitter_t* e, int nthreads) {
+    if (nthreads < 1) nthreads = 1;
+    if (nthreads > EMIT_MAX_THREADS) nthreads = EMIT_MAX_THREADS;
+    e->nthreads = nthreads;
 }
 
 /* --- low-level Intel templates (64-bit qword / rip-relative) --- */
+static void emit_data_slot(emitter_t* e, sym_entry_t* ent) {
+    out_writes3(e, ent->label, ":\n    .quad 0\n", "");
+}
+
+/* rip-relative operand into the counter section, offset in bytes */
+static void emit_prof_operand(emitter_t* e, size_t off) {
+    char buf[32]; write_int_buf((int) off, buf);
+    out_writes3(e, "qword ptr [rip + lsys_prof + ", buf, "]");
+}
+
 static void emit_preamble(emitter_t* e) {
-    fd_writes(e->out_fd, ".intel_syntax noprefix\n");
-    fd_writes(e->out_fd, "section .data\n");
-    /* emit variables in order they exist in scope */
-    for (size_t i = 0;; ++i) {
+    out_writes(e, ".intel_syntax noprefix\n");
+    out_writes(e, ".section .data\n");
+    if (e->data_order) {
+        /* profile-driven packing: hottest variables share the first cache lines */
+        for (size_t i = 0; i < e->scope->count; ++i) emit_data_slot(e, scope_entry_at(e->scope, e->data_order[i]));
+    } else {
+        /* emit variables in order they exist in scope */
+        for (size_t i = 0;; ++i) {
+            sym_entry_t* ent = scope_entry_at(e->scope, i);
+            if (!ent) break;
+            emit_data_slot(e, ent);
+        }
+    }
+    if (e->prof_out) {
+        /* header (magic, program fingerprint, statement count) then one counter per statement */
+        char buf[32];
+        out_writes(e, ".section .lsys_prof, \"aw\"\n.balign 64\nlsys_prof:\n");
+        out_writes(e, "    .quad " LSYS_PROF_MAGIC_STR "\n    .quad ");
+        out_writes(e, e->prof_fp_str);
+        out_writes(e, "\n    .quad ");
+        write_int_buf((int) e->nstmts, buf);
+        out_writes3(e, buf, "\n    .zero ", "");
+        write_int_buf((int) (8 * e->nstmts), buf);
+        out_writes3(e, buf, "\n", "");
+        out_writes(e, ".section .rodata\nlsys_prof_path:\n    .asciz \"");
+        for (const char* c = e->prof_out; *c; ++c) {
+            if (*c == '"' || *c == '\\') out_write(e, "\\", 1);
+            out_write(e, c, 1);
+        }
+        out_writes(e, "\"\n");
+    }
+    out_writes(e, ".section .text\n");
+    out_writes(e, ".global _start\n_start:\n");
+    for (size_t i = 0; i < e->scope->count; ++i) {
+        sym_entry_t* ent = scope_entry_at(e->scope, i);
+        if (!ent->reg) continue;
+        out_writes3(e, "    xor ", ent->reg, ", ");
+        out_writes3(e, ent->reg, "\n", "");
+    }
+}
+
+/* write promoted variables back to their slots, dump counters, exit(0) */
+static void emit_epilogue(emitter_t* e) {
+    for (size_t i = 0; i < e->scope->count; ++i) {
         sym_entry_t* ent = scope_entry_at(e->scope, i);
-        if (!ent) break;
-        fd_writes3(e->out_fd, ent->label, ":\n    dq 0\n", "");
+        if (!ent->reg) continue;
+        out_writes3(e, "    mov qword ptr [rip + ", ent->label, "], ");
+        out_writes3(e, ent->reg, "\n", "");
+    }
+    if (e->prof_out) {
+        char buf[32]; write_int_buf((int) (LSYS_PROF_HEADER + 8 * e->nstmts), buf);
+        /* openat(AT_FDCWD, path, O_WRONLY|O_CREAT|O_TRUNC, 0644) */
+        out_writes(e, "    mov rdi, -100\n    lea rsi, [rip + lsys_prof_path]\n");
+        out_writes(e, "    mov rdx, 577\n    mov r10, 420\n    mov rax, 257\n    syscall\n");
+        out_writes(e, "    test rax, rax\n    js .Llsys_prof_done\n");
+        out_writes(e, "    mov rdi, rax\n    lea rsi, [rip + lsys_prof]\n    mov rdx, ");
+        out_writes3(e, buf, "\n    mov rax, 1\n    syscall\n", "");
+        out_writes(e, "    mov rax, 3\n    syscall\n");
+        out_writes(e, ".Llsys_prof_done:\n");
     }
-    fd_writes(e->out_fd, "section .text\n");
-    fd_writes(e->out_fd, "global _start\n_start:\n");
+    /* exit(0) syscall */
+    out_writes(e, "    mov rax, 60\n");
+    out_writes(e, "    xor rdi, rdi\n");
+    out_writes(e, "    syscall\n");
 }
 
 static void emit_mov_reg_imm(emitter_t* e, const char* reg, int imm) {
     char buf[32]; write_int_buf(imm, buf);
-    fd_writes3(e->out_fd, "    mov ", reg, ", ");
-    fd_writes(e->out_fd, buf);
-    fd_writes(e->out_fd, "\n");
+    out_writes3(e, "    mov ", reg, ", ");
+    out_writes(e, buf);
+    out_writes(e, "\n");
 }
 
-static void emit_mov_reg_mem_rip(emitter_t* e, const char* reg, const char* label) {
-    fd_writes3(e->out_fd, "    mov ", reg, ", qword ptr [rip + ");
-    fd_writes3(e->out_fd, label, "]\n", "");
+/* a variable is a register (promoted global or leaf-function local),
+   a rip-relative global or a slot in the current function's frame */
+static void emit_var_operand(emitter_t* e, sym_entry_t* ent) {
+    if (ent->reg) {
+        out_writes(e, ent->reg);
+    } else if (ent->label) {
+        out_writes3(e, "qword ptr [rip + ", ent->label, "]");
+    } else {
+        char buf[32]; write_int_buf((int) (8 * (ent->slot + 1)), buf);
+        out_writes3(e, "qword ptr [rbp - ", buf, "]");
+    }
 }
 
-static void emit_mov_mem_rip_reg(emitter_t* e, const char* label, const char* reg) {
-    fd_writes3(e->out_fd, "    mov qword ptr [rip + ", label, "], ");
-    fd_writes3(e->out_fd, reg, "\n", "");
+static void emit_load_var(emitter_t* e, const char* reg, sym_entry_t* ent) {
+    out_writes3(e, "    mov ", reg, ", ");
+    emit_var_operand(e, ent);
+    out_writes(e, "\n");
 }
 
-static void emit_add_mem_rip_imm(emitter_t* e, const char* label, int imm) {
-    char buf[32]; write_int_buf(imm, buf);
-    fd_writes3(e->out_fd, "    add qword ptr [rip + ", label, "], ");
-    fd_writes(e->out_fd, buf);
-    fd_writes(e->out_fd, "\n");
+static void emit_store_var(emitter_t* e, sym_entry_t* ent, const char* reg) {
+    out_writes(e, "    mov ");
+    emit_var_operand(e, ent);
+    out_writes3(e, ", ", reg, "\n");
 }
 
-static void emit_sub_mem_rip_imm(emitter_t* e, const char* label, int imm) {
+/* op is "add" or "sub" */
+static void emit_arith_var_imm(emitter_t* e, const char* op, sym_entry_t* ent, int imm) {
     char buf[32]; write_int_buf(imm, buf);
-    fd_writes3(e->out_fd, "    sub qword ptr [rip + ", label, "], ");
-    fd_writes(e->out_fd, buf);
-    fd_writes(e->out_fd, "\n");
+    out_writes3(e, "    ", op, " ");
+    emit_var_operand(e, ent);
+    out_writes3(e, ", ", buf, "\n");
 }
 
 /* forward declaration */
 static void emit_expr(emitter_t* e, ast_node_t* expr);
 
+/* --- functions ---
+   calling convention: arguments in rdi, rsi, r8, r9, r10, r11 (rcx/rdx are
+   expression scratch), result in rax; rbp and r12-r15 are preserved, every
+   other register may be clobbered. leaf functions whose params and locals
+   fit in the argument registers keep them there and need no frame */
+
+struct emit_func {
+    ast_node_t* node;
+    scope_t scope;      /* params then locals, parent = globals */
+    size_t nparams;
+};
+
+struct emit_inline {
+    emit_func_t* fn;                   /* callee being expanded */
+    ast_node_t* args[EMIT_MAX_PARAMS];
+    scope_t* caller_scope;             /* arguments are evaluated here */
+};
+
+static const char* arg_regs[EMIT_MAX_PARAMS] = { "rdi", "rsi", "r8", "r9", "r10", "r11" };
+
+static int name_eq(const char* a, size_t alen, const char* b, size_t blen) {
+    return alen == blen && lstrncmp(a, b, alen) == 0;
+}
+
+/* keep the first error only */
+static void emit_error(emitter_t* e, const char* msg, const char* name, size_t len) {
+    if (e->error) return;
+    e->error = msg;
+    e->error_name = name;
+    e->error_name_len = len;
+}
+
+static emit_func_t* find_func(emitter_t* e, const char* name, size_t len) {
+    for (size_t i = 0; i < e->nfuncs; ++i) {
+        if (name_eq(e->funcs[i].node->name, e->funcs[i].node->name_len, name, len)) return &e->funcs[i];
+    }
+    return NULL;
+}
+
+static int param_index(emit_func_t* f, const char* name, size_t len) {
+    int i = 0;
+    for (ast_node_t* p = f->node->left; p; p = p->next, ++i) {
+        if (name_eq(p->name, p->name_len, name, len)) return i;
+    }
+    return -1;
+}
+
+static sym_entry_t* lookup_var(emitter_t* e, const char* name, size_t len) {
+    return scope_find(e->scope, name, len);
+}
+
+static size_t list_len(ast_node_t* n) {
+    size_t c = 0;
+    for (; n; n = n->next) ++c;
+    return c;
+}
+
+static int expr_has_call(ast_node_t* expr) {
+    if (!expr) return 0;
+    if (expr->type == NODE_CALL) return 1;
+    if (expr->type == NODE_BINOP) return expr_has_call(expr->left) || expr_has_call(expr->right);
+    return 0;
+}
+
+static int expr_nodes(ast_node_t* expr) {
+    if (!expr) return 0;
+    if (expr->type == NODE_BINOP) return 1 + expr_nodes(expr->left) + expr_nodes(expr->right);
+    return 1;
+}
+
+/* node count once parameters are replaced by their arguments. arguments
+   live in the caller, so their names are not looked up as parameters again */
+static int inline_cost(emit_func_t* f, ast_node_t* expr, ast_node_t** args) {
+    if (!expr) return 0;
+    if (expr->type == NODE_VAR) {
+        int i = param_index(f, expr->name, expr->name_len);
+        return i >= 0 ? expr_nodes(args[i]) : 1;
+    }
+    if (expr->type == NODE_BINOP) return 1 + inline_cost(f, expr->left, args) + inline_cost(f, expr->right, args);
+    return 1;
+}
+
+/* expand `return expr;` bodies in place when nothing has side effects (no
+   calls in the body or the arguments, so substituting arguments is exact)
+   and the substituted expression stays within the budget */
+static int call_inlines(emit_func_t* f, ast_node_t* call, ast_node_t** args) {
+    ast_node_t* body = f->node->right;
+    if (!body || body->next || body->type != NODE_RETURN || !body->left) return 0;
+    if (expr_has_call(body->left)) return 0;
+    size_t n = 0;
+    for (ast_node_t* a = call->left; a; a = a->next) {
+        if (expr_has_call(a)) return 0;
+        args[n++] = a;
+    }
+    return inline_cost(f, body->left, args) <= EMIT_INLINE_BUDGET;
+}
+
+static void emit_call(emitter_t* e, ast_node_t* call) {
+    /* bad calls were rejected by emitter_check_stmts */
+    emit_func_t* f = find_func(e, call->name, call->name_len);
+    size_t argc = list_len(call->left);
+    if (!f || argc != f->nparams || argc > EMIT_MAX_PARAMS) return;
+
+    emit_inline_t env;
+    if (call_inlines(f, call, env.args)) {
+        env.fn = f;
+        env.caller_scope = e->scope;
+        emit_inline_t* prev_inl = e->inl;
+        e->inl = &env;
+        e->scope = &f->scope;
+        emit_expr(e, f->node->right->left);
+        e->scope = env.caller_scope;
+        e->inl = prev_inl;
+        return;
+    }
+
+    for (ast_node_t* a = call->left; a; a = a->next) {
+        emit_expr(e, a);
+        out_writes(e, "    push rax\n");
+    }
+    for (size_t i = argc; i > 0; --i) out_writes3(e, "    pop ", arg_regs[i - 1], "\n");
+    out_writes(e, "    call f_");
+    out_write(e, call->name, call->name_len);
+    out_writes(e, "\n");
+}
+
+/* a parameter of the function being inlined: evaluate the argument in the caller */
+static int try_emit_inline_param(emitter_t* e, ast_node_t* var) {
+    if (!e->inl) return 0;
+    int i = param_index(e->inl->fn, var->name, var->name_len);
+    if (i < 0) return 0;
+    emit_inline_t* env = e->inl;
+    scope_t* callee_scope = e->scope;
+    e->inl = NULL;
+    e->scope = env->caller_scope;
+    emit_expr(e, env->args[i]);
+    e->scope = callee_scope;
+    e->inl = env;
+    return 1;
+}
+
 /* try simple optimization: var = var + imm  (or var = var - imm) */
 static int try_emit_simple_mem_binop_optim(emitter_t* e, ast_node_t* stmt) {
     if (!stmt || stmt->type != NODE_ASSIGN) return 0;
@@ -102,17 +393,92 @@ static int try_emit_simple_mem_binop_optim(emitter_t* e, ast_node_t* stmt) {
     if (lstrncmp(stmt->name, rhs->left->name, stmt->name_len) != 0) return 0;
 
     if (rhs->op == OP_ADD) {
-        emit_add_mem_rip_imm(e, scope_get_label(e->scope, stmt->name, stmt->name_len), rhs->right->int_value);
+        emit_arith_var_imm(e, "add", lookup_var(e, stmt->name, stmt->name_len), rhs->right->int_value);
         return 1;
     }
     if (rhs->op == OP_SUB) {
-        emit_sub_mem_rip_imm(e, scope_get_label(e->scope, stmt->name, stmt->name_len), rhs->right->int_value);
+        emit_arith_var_imm(e, "sub", lookup_var(e, stmt->name, stmt->name_len), rhs->right->int_value);
         return 1;
     }
     /* for mul/div, skip optimization for now */
     return 0;
 }
 
+/* --- superoptimizer rewrites --- */
+
+struct emit_rewrite {
+    const char* key;    /* NULL = empty slot */
+    size_t key_len;
+    const char* seq;    /* "insn; insn; ..." */
+    size_t seq_len;
+};
+
+static emit_rewrite_t* find_rewrite(emitter_t* e, const char* key, size_t len) {
+    size_t i = (size_t) lfnv1a(LFNV_OFFSET, key, len) & (e->rw_cap - 1);
+    for (; e->rw[i].key; i = (i + 1) & (e->rw_cap - 1)) {
+        if (name_eq(e->rw[i].key, e->rw[i].key_len, key, len)) return &e->rw[i];
+    }
+    return &e->rw[i];
+}
+
+void emitter_use_rewrites(emitter_t* e, const char* data, size_t len) {
+    size_t lines = 0;
+    for (size_t i = 0; i < len; ++i) lines += data[i] == '\n';
+    size_t cap = 16;
+    while (cap < 2 * (lines + 1)) cap *= 2;
+    emit_rewrite_t* rw = (emit_rewrite_t*) e->alloc(sizeof(emit_rewrite_t) * cap);
+    if (!rw) return;
+    for (size_t i = 0; i < cap; ++i) rw[i].key = NULL;
+    e->rw = rw;
+    e->rw_cap = cap;
+
+    size_t p = 0;
+    while (p < len) {
+        size_t end = p, tab = 0;
+        while (end < len && data[end] != '\n') {
+            if (data[end] == '\t' && !tab) tab = end;
+            ++end;
+        }
+        if (data[p] != '#' && tab > p) {    /* the sequence may be empty */
+            emit_rewrite_t* slot = find_rewrite(e, data + p, tab - p);
+            if (!slot->key) {   /* first line for a key wins */
+                slot->key = data + p;
+                slot->key_len = tab - p;
+                slot->seq = data + tab + 1;
+                slot->seq_len = end - tab - 1;
+            }
+        }
+        p = end + 1;
+    }
+}
+
+/* a tree with a db entry: x into rax, y into rcx, then the sequence. not
+   inside an inlined body, where parameters stand for argument expressions */
+static int try_emit_rewrite(emitter_t* e, ast_node_t* expr) {
+    if (!e->rw || e->inl) return 0;
+    char key[SUPEROPT_KEY_MAX];
+    ast_node_t* vars[2];
+    size_t klen = superopt_key(expr, key, sizeof(key), vars);
+    if (!klen) return 0;
+    emit_rewrite_t* rw = find_rewrite(e, key, klen);
+    if (!rw->key) return 0;
+
+    emit_load_var(e, "rax", lookup_var(e, vars[0]->name, vars[0]->name_len));
+    if (vars[1]) emit_load_var(e, "rcx", lookup_var(e, vars[1]->name, vars[1]->name_len));
+    const char* p = rw->seq;
+    const char* end = rw->seq + rw->seq_len;
+    while (p < end) {
+        const char* q = p;
+        while (q < end && *q != ';') ++q;
+        out_writes(e, "    ");
+        out_write(e, p, (size_t) (q - p));
+        out_writes(e, "\n");
+        p = q + 1;
+        while (p < end && *p == ' ') ++p;
+    }
+    return 1;
+}
+
 /* emit expression into RAX.
    Uses push/pop to protect temporaries for nested expressions; keeps register interference minimal.
 */
@@ -125,45 +491,50 @@ static void emit_expr(emitter_t* e, ast_node_t* expr) {
             return;
         }
         case NODE_VAR: {
-            char* lbl = scope_get_label(e->scope, expr->name, expr->name_len);
-            emit_mov_reg_mem_rip(e, "rax", lbl);
+            if (try_emit_inline_param(e, expr)) return;
+            emit_load_var(e, "rax", lookup_var(e, expr->name, expr->name_len));
+            return;
+        }
+        case NODE_CALL: {
+            emit_call(e, expr);
             return;
         }
         case NODE_BINOP: {
+            if (try_emit_rewrite(e, expr)) return;
             /* Evaluate left into rax */
             emit_expr(e, expr->left);
             /* save left */
-            fd_writes(e->out_fd, "    push rax\n");
+            out_writes(e, "    push rax\n");
             /* evaluate right into rax */
             emit_expr(e, expr->right);
             /* pop left into rbx */
-            fd_writes(e->out_fd, "    pop rbx\n");
+            out_writes(e, "    pop rbx\n");
             /* now: rax = right, rbx = left */
             switch (expr->op) {
                 case OP_ADD:
                     /* rax = right + left (commutative) */
-                    fd_writes(e->out_fd, "    add rax, rbx\n");
+                    out_writes(e, "    add rax, rbx\n");
                     break;
                 case OP_SUB:
                     /* compute left - right into rax */
-                    fd_writes(e->out_fd, "    mov rcx, rbx\n    sub rcx, rax\n    mov rax, rcx\n");
+                    out_writes(e, "    mov rcx, rbx\n    sub rcx, rax\n    mov rax, rcx\n");
                     break;
                 case OP_MUL:
                     /* rax = right * left */
-                    fd_writes(e->out_fd, "    imul rax, rbx\n");
+                    out_writes(e, "    imul rax, rbx\n");
                     break;
                 case OP_DIV:
                     /* left / right : move left into rax, divisor in rcx */
-                    fd_writes(e->out_fd, "    mov rcx, rax\n    mov rax, rbx\n    cqo\n    idiv rcx\n");
+                    out_writes(e, "    mov rcx, rax\n    mov rax, rbx\n    cqo\n    idiv rcx\n");
                     break;
                 default:
-                    fd_writes(e->out_fd, "    ; error: unsupported binop\n");
+                    out_writes(e, "    ; error: unsupported binop\n");
                     break;
             }
             return;
         }
         default:
-            fd_writes(e->out_fd, "    ; error: unsupported expr node\n");
+            out_writes(e, "    ; error: unsupported expr node\n");
             return;
     }
 }
@@ -177,41 +548,552 @@ static void emit_assign_stmt(emitter_t* e, ast_node_t* stmt) {
 
     /* general: evaluate RHS into rax, then store into [label] */
     emit_expr(e, stmt->left);
-    char* lbl = scope_get_label(e->scope, stmt->name, stmt->name_len);
-    emit_mov_mem_rip_reg(e, lbl, "rax");
+    emit_store_var(e, lookup_var(e, stmt->name, stmt->name_len), "rax");
 }
 
-/* public entry: emit whole program */
-int emitter_emit_program(emitter_t* e, ast_node_t* prog) {
+/* calls left after inlining */
+static int body_has_real_call(emitter_t* e, ast_node_t* expr) {
+    if (!expr) return 0;
+    if (expr->type == NODE_BINOP) return body_has_real_call(e, expr->left) || body_has_real_call(e, expr->right);
+    if (expr->type != NODE_CALL) return 0;
+    emit_func_t* f = find_func(e, expr->name, expr->name_len);
+    ast_node_t* args[EMIT_MAX_PARAMS];
+    if (!f || list_len(expr->left) != f->nparams || f->nparams > EMIT_MAX_PARAMS) return 0; /* rejected */
+    return !call_inlines(f, expr, args);
+}
+
+static void emit_function(emitter_t* e, emit_func_t* f) {
+    ast_node_t* fn = f->node;
+    out_write(e, "f_", 2);
+    out_write(e, fn->name, fn->name_len);
+    out_writes(e, ":\n");
+    if (f->nparams > EMIT_MAX_PARAMS) {   /* rejected by emitter_add_funcs */
+        out_writes(e, "    ret\n");
+        return;
+    }
+
+    int leaf = 1;
+    for (ast_node_t* st = fn->right; st && leaf; st = st->next) {
+        if (st->type == NODE_CALL) leaf = !body_has_real_call(e, st);
+        else if (body_has_real_call(e, st->left)) leaf = 0;
+    }
+    size_t nvars = f->scope.count;
+    int frame = !leaf || nvars > EMIT_MAX_PARAMS;
+    char buf[32];
+    if (frame) {
+        write_int_buf((int) (8 * nvars), buf);
+        out_writes3(e, "    push rbp\n    mov rbp, rsp\n    sub rsp, ", buf, "\n");
+    }
+    for (size_t i = 0; i < nvars; ++i) {
+        sym_entry_t* ent = scope_entry_at(&f->scope, i);
+        ent->reg = frame ? NULL : arg_regs[i];
+        if (i < f->nparams) {
+            if (frame) emit_store_var(e, ent, arg_regs[i]);
+        } else if (frame) {
+            out_writes(e, "    mov ");
+            emit_var_operand(e, ent);
+            out_writes(e, ", 0\n");
+        } else {
+            out_writes3(e, "    xor ", ent->reg, ", ");
+            out_writes3(e, ent->reg, "\n", "");
+        }
+    }
+
+    scope_t* prev_scope = e->scope;
+    e->scope = &f->scope;
+    int returned = 0;
+    for (ast_node_t* st = fn->right; st; st = st->next) {
+        returned = 0;
+        switch (st->type) {
+            case NODE_ASSIGN: emit_assign_stmt(e, st); break;
+            case NODE_CALL: emit_call(e, st); break;
+            case NODE_RETURN:
+                if (st->left) emit_expr(e, st->left);
+                else out_writes(e, "    xor rax, rax\n");
+                if (st->next) {
+                    out_write(e, "    jmp .Lret_", 14);
+                    out_write(e, fn->name, fn->name_len);
+                    out_writes(e, "\n");
+                }
+                returned = 1;
+                break;
+            default:
+                out_writes(e, "    ; error: unsupported statement in function\n");
+                break;
+        }
+    }
+    e->scope = prev_scope;
+    if (!returned) out_writes(e, "    xor rax, rax\n");
+    out_write(e, ".Lret_", 6);
+    out_write(e, fn->name, fn->name_len);
+    out_writes(e, ":\n");
+    if (frame) out_writes(e, "    leave\n");
+    out_writes(e, "    ret\n");
+}
+
+/* bodies of the functions defined in a statement list, after the exit sequence */
+static void emit_funcs(emitter_t* e, ast_node_t* first) {
+    for (ast_node_t* cur = first; cur; cur = cur->next) {
+        if (cur->type != NODE_FUNC) continue;
+        emit_func_t* f = find_func(e, cur->name, cur->name_len);
+        if (f && f->node == cur) emit_function(e, f);   /* duplicates were rejected */
+    }
+}
+
+/* true if name is a parameter of fn, or assigned in its body without being
+   assigned at top level (those stay globals, as in C) */
+static int is_func_local(emitter_t* e, ast_node_t* fn, const char* name, size_t len) {
+    for (ast_node_t* p = fn->left; p; p = p->next) {
+        if (name_eq(p->name, p->name_len, name, len)) return 1;
+    }
+    for (ast_node_t* st = fn->right; st; st = st->next) {
+        if (st->type == NODE_ASSIGN && name_eq(st->name, st->name_len, name, len)) {
+            sym_entry_t* g = scope_find(e->scope, name, len);
+            return !g || (size_t) (g - e->scope->entries) >= e->nglobal_targets;
+        }
+    }
+    return 0;
+}
+
+void emitter_add_funcs(emitter_t* e, ast_node_t* stmts) {
+    for (ast_node_t* cur = stmts; cur; cur = cur->next) {
+        if (cur->type != NODE_FUNC) continue;
+        if (find_func(e, cur->name, cur->name_len)) {
+            emit_error(e, "duplicate function", cur->name, cur->name_len);
+            continue;
+        }
+        if (list_len(cur->left) > EMIT_MAX_PARAMS) emit_error(e, "too many parameters", cur->name, cur->name_len);
+        if (e->nfuncs == e->funcs_cap) {
+            size_t newcap = e->funcs_cap ? e->funcs_cap * 2 : 8;
+            emit_func_t* nf = (emit_func_t*) e->alloc(sizeof(emit_func_t) * newcap);
+            if (!nf) return;
+            for (size_t i = 0; i < e->nfuncs; ++i) nf[i] = e->funcs[i];
+            if (e->funcs) e->free_fn(e->funcs);
+            e->funcs = nf;
+            e->funcs_cap = newcap;
+        }
+        emit_func_t* f = &e->funcs[e->nfuncs++];
+        f->node = cur;
+        f->nparams = list_len(cur->left);
+        /* params first so their slots match argument order, then assigned locals */
+        scope_init_nested(&f->scope, e->scope);
+        for (ast_node_t* p = cur->left; p; p = p->next) scope_get_entry(&f->scope, p->name, p->name_len);
+        for (ast_node_t* st = cur->right; st; st = st->next) {
+            if (st->type == NODE_ASSIGN && is_func_local(e, cur, st->name, st->name_len)) {
+                scope_get_entry(&f->scope, st->name, st->name_len);
+            }
+        }
+    }
+}
+
+static void check_expr(emitter_t* e, ast_node_t* expr) {
+    if (!expr) return;
+    if (expr->type == NODE_BINOP) {
+        check_expr(e, expr->left);
+        check_expr(e, expr->right);
+    } else if (expr->type == NODE_CALL) {
+        emit_func_t* f = find_func(e, expr->name, expr->name_len);
+        if (!f) emit_error(e, "call to undefined function", expr->name, expr->name_len);
+        else if (list_len(expr->left) != f->nparams) emit_error(e, "wrong number of arguments", expr->name, expr->name_len);
+        for (ast_node_t* a = expr->left; a; a = a->next) check_expr(e, a);
+    }
+}
+
+void emitter_check_stmts(emitter_t* e, ast_node_t* stmts) {
+    for (ast_node_t* st = stmts; st; st = st->next) {
+        if (st->type == NODE_ASSIGN) check_expr(e, st->left);
+        else if (st->type == NODE_CALL) check_expr(e, st);
+        else if (st->type == NODE_RETURN) emit_error(e, "return outside a function", NULL, 0);
+        else if (st->type == NODE_FUNC) {
+            for (ast_node_t* b = st->right; b; b = b->next) {
+                if (b->type == NODE_CALL) check_expr(e, b);
+                else check_expr(e, b->left);
+            }
+        }
+    }
+}
+
+static int func_assigns(ast_node_t* fn, const char* name, size_t len) {
+    for (ast_node_t* st = fn->right; st; st = st->next) {
+        if (st->type == NODE_ASSIGN && name_eq(st->name, st->name_len, name, len)) return 1;
+    }
+    return 0;
+}
+
+void emitter_check_globals(emitter_t* e) {
+    for (size_t i = e->nglobal_targets; i < e->scope->count; ++i) {
+        sym_entry_t* g = scope_entry_at(e->scope, i);
+        for (size_t j = 0; j < e->nfuncs; ++j) {
+            if (!func_assigns(e->funcs[j].node, g->name, g->name_len)) continue;
+            const char* msg = " is only assigned inside functions, where it is local; reads elsewhere see 0\n";
+            lwrite_all(2, "warning: ", 9);
+            lwrite_all(2, g->name, g->name_len);
+            lwrite_all(2, msg, lstrlen(msg));
+            break;
+        }
+    }
+}
+
+/* emit one top-level statement; idx is its position in the program */
+static void emit_stmt(emitter_t* e, ast_node_t* stmt, size_t idx) {
+    if (e->prof_out) {
+        out_writes(e, "    inc ");
+        emit_prof_operand(e, LSYS_PROF_HEADER + 8 * idx);
+        out_writes(e, "\n");
+    }
+    if (stmt->type == NODE_ASSIGN) {
+        emit_assign_stmt(e, stmt);
+    } else if (stmt->type == NODE_CALL) {
+        emit_call(e, stmt);
+    } else if (stmt->type != NODE_FUNC) {
+        out_writes(e, "    ; syntax error: unsupported top-level statement\n");
+    }
+}
+
+static void expr_reads(ast_node_t* expr, void (*fn)(void*, const char*, size_t), void* ctx) {
+    if (!expr) return;
+    if (expr->type == NODE_VAR) {
+        fn(ctx, expr->name, expr->name_len);
+        return;
+    }
+    if (expr->type == NODE_BINOP) {
+        expr_reads(expr->left, fn, ctx);
+        expr_reads(expr->right, fn, ctx);
+    } else if (expr->type == NODE_CALL) {
+        for (ast_node_t* a = expr->left; a; a = a->next) expr_reads(a, fn, ctx);
+    }
+}
+
+/* globals read inside a function body: everything that is not a local */
+typedef struct {
+    emitter_t* e;
+    ast_node_t* fn_node;
+    void (*fn)(void*, const char*, size_t);
+    void* ctx;
+} func_reads_t;
+
+static void func_read(void* ctx, const char* name, size_t len) {
+    func_reads_t* fr = (func_reads_t*) ctx;
+    if (!is_func_local(fr->e, fr->fn_node, name, len)) fr->fn(fr->ctx, name, len);
+}
+
+void emitter_stmt_targets(ast_node_t* stmt, void (*fn)(void*, const char*, size_t), void* ctx) {
+    if (stmt->type == NODE_ASSIGN) fn(ctx, stmt->name, stmt->name_len);
+}
+
+void emitter_targets_done(emitter_t* e) { e->nglobal_targets = e->scope->count; }
+
+void emitter_stmt_reads(emitter_t* e, ast_node_t* stmt, void (*fn)(void*, const char*, size_t), void* ctx) {
+    if (stmt->type == NODE_ASSIGN) expr_reads(stmt->left, fn, ctx);
+    else if (stmt->type == NODE_CALL) expr_reads(stmt, fn, ctx);
+    else if (stmt->type == NODE_FUNC) {
+        func_reads_t fr = { e, stmt, fn, ctx };
+        for (ast_node_t* st = stmt->right; st; st = st->next) {
+            if (st->type == NODE_CALL) expr_reads(st, func_read, &fr);
+            else if (st->type == NODE_ASSIGN || st->type == NODE_RETURN) expr_reads(st->left, func_read, &fr);
+        }
+    }
+}
+
+static void register_name(void* ctx, const char* name, size_t len) {
+    scope_get_label((scope_t*) ctx, name, len);
+}
+
+/* --- profile feedback --- */
+
+static uint64_t hash_list(uint64_t h, ast_node_t* n);
+
+static uint64_t hash_node(uint64_t h, ast_node_t* n) {
+    h = lfnv1a(h, &n->type, sizeof(n->type));
+    switch (n->type) {
+        case NODE_INT: return lfnv1a(h, &n->int_value, sizeof(n->int_value));
+        case NODE_VAR: return lfnv1a(h, n->name, n->name_len);
+        case NODE_BINOP:
+            h = lfnv1a(h, &n->op, sizeof(n->op));
+            h = hash_list(h, n->left);
+            return hash_list(h, n->right);
+        case NODE_ASSIGN: case NODE_CALL: case NODE_FUNC: case NODE_RETURN:
+            h = lfnv1a(h, n->name, n->name_len);
+            h = hash_list(h, n->left);
+            return hash_list(h, n->right);
+        default: return h;
+    }
+}
+
+/* a node and its next-siblings, '-' closing the list */
+static uint64_t hash_list(uint64_t h, ast_node_t* n) {
+    for (; n; n = n->next) h = hash_node(h, n);
+    return lfnv1a(h, "-", 1);
+}
+
+/* identifies the statement list a profile was recorded for */
+static uint64_t program_fingerprint(ast_node_t* prog) {
+    return hash_list(LFNV_OFFSET, prog);
+}
+
+static void add_expr_weight(emitter_t* e, uint64_t* weight, ast_node_t* expr, uint64_t count) {
+    if (!expr) return;
+    if (expr->type == NODE_VAR) {
+        weight[scope_get_entry(e->scope, expr->name, expr->name_len) - e->scope->entries] += count;
+    } else if (expr->type == NODE_BINOP) {
+        add_expr_weight(e, weight, expr->left, count);
+        add_expr_weight(e, weight, expr->right, count);
+    } else if (expr->type == NODE_CALL) {
+        for (ast_node_t* a = expr->left; a; a = a->next) add_expr_weight(e, weight, a, count);
+    }
+}
+
+/* weigh every variable by how often the statements touching it ran, promote
+   the hottest into callee-saved registers and order .data hottest first */
+static void apply_profile(emitter_t* e, ast_node_t* prog, uint64_t fp) {
+    const uint64_t* hdr = (const uint64_t*) e->prof_in;
+    if (e->prof_in_len < LSYS_PROF_HEADER || hdr[0] != LSYS_PROF_MAGIC || hdr[1] != fp || hdr[2] != e->nstmts ||
+        e->prof_in_len < LSYS_PROF_HEADER + 8 * e->nstmts) {
+        const char* msg = "warning: profile does not match this program, ignoring it\n";
+        lwrite_all(2, msg, lstrlen(msg));
+        return;
+    }
+    const uint64_t* counts = hdr + LSYS_PROF_HEADER / 8;
+
+    size_t nvars = e->scope->count;
+    uint64_t* weight = (uint64_t*) e->alloc(sizeof(uint64_t) * (nvars ? nvars : 1));
+    size_t* order = (size_t*) e->alloc(sizeof(size_t) * (nvars ? nvars : 1));
+    if (!weight || !order) {
+        if (weight) e->free_fn(weight);
+        if (order) e->free_fn(order);
+        return;
+    }
+    for (size_t i = 0; i < nvars; ++i) { weight[i] = 0; order[i] = i; }
+
+    size_t idx = 0;
+    for (ast_node_t* cur = prog; cur; cur = cur->next, ++idx) {
+        if (cur->type == NODE_CALL) add_expr_weight(e, weight, cur, counts[idx]);
+        if (cur->type != NODE_ASSIGN) continue;
+        weight[scope_get_entry(e->scope, cur->name, cur->name_len) - e->scope->entries] += counts[idx];
+        add_expr_weight(e, weight, cur->left, counts[idx]);
+    }
+
+    /* stable insertion sort by descending weight keeps first-appearance order for ties */
+    for (size_t i = 1; i < nvars; ++i) {
+        size_t v = order[i];
+        size_t j = i;
+        while (j > 0 && weight[order[j - 1]] < weight[v]) { order[j] = order[j - 1]; --j; }
+        order[j] = v;
+    }
+
+    static const char* promote_regs[] = { "r12", "r13", "r14", "r15" };
+    for (size_t i = 0; i < nvars && i < sizeof(promote_regs) / sizeof(promote_regs[0]); ++i) {
+        if (weight[order[i]] == 0) break;
+        scope_entry_at(e->scope, order[i])->reg = promote_regs[i];
+    }
+    e->data_order = order;
+    e->free_fn(weight);
+}
+
+/* --- parallel emission --- */
+
+/* one contiguous range of statements emitted by a worker into its own buffer */
+typedef struct {
+    emitter_t em;
+    emit_buf_t buf;
+    ast_node_t* first;
+    size_t first_idx;
+    size_t count;
+    lthread_t th;
+    int spawned;
+} emit_job_t;
+
+static int emit_job_run(void* arg) {
+    emit_job_t* job = (emit_job_t*) arg;
+    ast_node_t* cur = job->first;
+    for (size_t i = 0; i < job->count && cur; ++i, cur = cur->next) {
+        emit_stmt(&job->em, cur, job->first_idx + i);
+    }
+    return 0;
+}
+
+/* writev every buffer in order, resuming after short writes; -1 on an error */
+static int fd_writev_all(int fd, struct iovec* iov, int cnt) {
+    while (cnt > 0) {
+        ssize_t wr = writev(fd, iov, cnt);
+        if (wr <= 0) return -1;
+        size_t left = (size_t) wr;
+        while (cnt > 0 && left >= iov->iov_len) {
+            left -= iov->iov_len;
+            ++iov; --cnt;
+        }
+        if (cnt > 0) {
+            iov->iov_base = (char*) iov->iov_base + left;
+            iov->iov_len -= left;
+        }
+    }
+    return 0;
+}
+
+/* emit statements with a frozen scope: workers fill private buffers, the
+   calling thread takes the first range, then all buffers go out in order */
+static void emit_stmts_parallel(emitter_t* e, ast_node_t* prog) {
+    size_t n = e->nstmts;
+    if (n == 0) return;
+    scope_freeze(e->scope);
+
+    size_t njobs = (size_t) e->nthreads;
+    if (njobs > n) njobs = n;
+    emit_job_t* jobs = (emit_job_t*) e->alloc(sizeof(emit_job_t) * njobs);
+    if (!jobs) {
+        size_t idx = 0;
+        for (ast_node_t* cur = prog; cur; cur = cur->next) emit_stmt(e, cur, idx++);
+        return;
+    }
+
+    ast_node_t* cur = prog;
+    size_t idx = 0;
+    for (size_t j = 0; j < njobs; ++j) {
+        emit_job_t* job = &jobs[j];
+        job->em = *e;
+        job->buf.data = NULL; job->buf.len = 0; job->buf.cap = 0;
+        job->em.buf = &job->buf;
+        job->first = cur;
+        job->first_idx = idx;
+        job->count = n / njobs + (j < n % njobs ? 1 : 0);
+        job->spawned = 0;
+        for (size_t i = 0; i < job->count; ++i) cur = cur->next;
+        idx += job->count;
+    }
+
+    /* stacks first: once workers run, the allocation tag must stay put */
+    lmem_tag_t prev_tag = lmem_set_tag(LMEM_TAG_THREAD_STACK);
+    for (size_t j = 1; j < njobs; ++j) {
+        jobs[j].spawned = lthread_alloc(&jobs[j].th, e->alloc) == 0;
+    }
+    lmem_set_tag(prev_tag);
+    for (size_t j = 1; j < njobs; ++j) {
+        if (jobs[j].spawned && lthread_start(&jobs[j].th, emit_job_run, &jobs[j]) != 0) {
+            e->free_fn(jobs[j].th.stack);
+            jobs[j].spawned = 0;
+        }
+    }
+    emit_job_run(&jobs[0]);
+    for (size_t j = 1; j < njobs; ++j) {
+        if (jobs[j].spawned) lthread_join(&jobs[j].th, e->free_fn);
+        else emit_job_run(&jobs[j]); /* could not spawn: emit inline */
+    }
+    /* a worker that dropped output makes the whole program's output incomplete */
+    for (size_t j = 0; j < njobs; ++j) e->out_failed |= jobs[j].em.out_failed;
+
+    if (e->sink) {
+        /* whole buffers go to the sink as they are, behind what is staged */
+        sink_flush(e);
+        for (size_t j = 0; j < njobs; ++j) {
+            if (!jobs[j].buf.len) continue;
+            e->sink(e->sink_ctx, jobs[j].buf.data, jobs[j].buf.len);
+            jobs[j].buf.data = NULL;
+        }
+    } else {
+        struct iovec iov[EMIT_MAX_THREADS];
+        for (size_t j = 0; j < njobs; ++j) {
+            iov[j].iov_base = jobs[j].buf.data;
+            iov[j].iov_len = jobs[j].buf.len;
+        }
+        if (fd_writev_all(e->out_fd, iov, (int) njobs) != 0) e->out_failed = 1;
+    }
+
+    for (size_t j = 0; j < njobs; ++j) {
+        if (jobs[j].buf.data) e->free_fn(jobs[j].buf.data);
+    }
+    e->free_fn(jobs);
+}
+
+void emitter_emit_preamble(emitter_t* e) { emit_preamble(e); }
+
+void emitter_emit_stmts(emitter_t* e, ast_node_t* first, emit_buf_t* out) {
+    emit_buf_t* prev = e->buf;
+    e->buf = out;
+    size_t idx = 0;
+    for (ast_node_t* cur = first; cur; cur = cur->next) emit_stmt(e, cur, idx++);
+    e->buf = prev;
+}
+
+void emitter_emit_epilogue(emitter_t* e) { emit_epilogue(e); }
+
+void emitter_emit_funcs(emitter_t* e, ast_node_t* first, emit_buf_t* out) {
+    emit_buf_t* prev = e->buf;
+    e->buf = out;
+    emit_funcs(e, first);
+    e->buf = prev;
+}
+
+/* registration, checks and profile: everything before the first byte of output */
+int emitter_prepare_program(emitter_t* e, ast_node_t* prog) {
     /* register variables in scope in **program order** (top-level statements only) */
     ast_node_t* cur = prog;
+    e->nstmts = 0;
     while (cur) {
-        if (cur->type == NODE_ASSIGN) {
-            scope_get_label(e->scope, cur->name, cur->name_len);
-        }
+        emitter_stmt_targets(cur, register_name, e->scope);
+        e->nstmts++;
         cur = cur->next;
     }
+    /* then everything read, in the order emission would create it, so each
+       variable has a .data slot and the scope stays fixed during emission */
+    emitter_targets_done(e);
+    for (cur = prog; cur; cur = cur->next) emitter_stmt_reads(e, cur, register_name, e->scope);
+    emitter_add_funcs(e, prog);
+    emitter_check_stmts(e, prog);
+    if (e->error) return -1;
+    emitter_check_globals(e);
 
+    if (e->prof_out || e->prof_in) {
+        uint64_t fp = program_fingerprint(prog);
+        /* hex, so it survives the assembler regardless of sign */
+        static const char hex[] = "0123456789abcdef";
+        e->prof_fp_str[0] = '0'; e->prof_fp_str[1] = 'x';
+        for (int i = 0; i < 16; ++i) e->prof_fp_str[2 + i] = hex[(fp >> (60 - 4 * i)) & 0xf];
+        e->prof_fp_str[18] = '\0';
+        if (e->prof_in) apply_profile(e, prog, fp);
+    }
+    return 0;
+}
+
+void emitter_emit_prepared(emitter_t* e, ast_node_t* prog) {
     /* preamble */
     emit_preamble(e);
 
     /* emit statements in order */
-    cur = prog;
-    while (cur) {
-        if (cur->type == NODE_ASSIGN) {
-            emit_assign_stmt(e, cur);
-        } else {
-            fd_writes(e->out_fd, "    ; syntax error: unsupported top-level statement\n");
-        }
-        cur = cur->next;
+    if (e->nthreads > 1) {
+        emit_stmts_parallel(e, prog);
+    } else {
+        size_t idx = 0;
+        for (ast_node_t* cur = prog; cur; cur = cur->next) emit_stmt(e, cur, idx++);
     }
 
-    /* exit(0) syscall */
-    fd_writes(e->out_fd, "    mov rax, 60\n");
-    fd_writes(e->out_fd, "    xor rdi, rdi\n");
-    fd_writes(e->out_fd, "    syscall\n");
+    emit_epilogue(e);
+    emit_funcs(e, prog);
+}
+
+/* public entry: emit whole program */
+int emitter_emit_program(emitter_t* e, ast_node_t* prog) {
+    if (emitter_prepare_program(e, prog) != 0) return -1;
+    emitter_emit_prepared(e, prog);
     return 0;
 }
 
-void emitter_close(emitter_t* e) { (void)e; }
+void emitter_instrument(emitter_t* e, const char* profile_path) { e->prof_out = profile_path; }
+
+void emitter_use_profile(emitter_t* e, const void* data, size_t len) {
+    e->prof_in = data;
+    e->prof_in_len = len;
+}
+
+void emitter_close(emitter_t* e) {
+    if (e->sink) sink_flush(e);
+    if (e->sink_buf.data) e->free_fn(e->sink_buf.data);
+    e->sink_buf.data = NULL;
+    if (e->data_order) e->free_fn(e->data_order);
+    e->data_order = NULL;
+    if (e->funcs) e->free_fn(e->funcs);
+    e->funcs = NULL;
+    if (e->rw) e->free_fn(e->rw);
+    e->rw = NULL;
+    e->nfuncs = 0;
+}
 
@@ -0,0 +1,425 @@
+#include "incr.h"
+#include "lexer.h"
+#include "parser.h"
+#include "scope.h"
+#include "lstr.h"
+#include "lmem.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdint.h>
+
+/* from start.s */
+int rename(const char* oldpath, const char* newpath);
+
+/* on-disk layout: header, one record per segment, then the blob holding every
+   fragment back to back in segment order, followed by the name lists */
+typedef struct {
+    uint64_t magic;
+    uint64_t layout;     /* hash of the scope's variable order and every function definition */
+    uint64_t nsegs;
+    uint64_t blob_len;
+} incr_hdr_t;
+
+typedef struct {
+    uint64_t hash;       /* FNV-1a of the segment text */
+    uint64_t src_len;
+    uint64_t frag_off;   /* into the blob */
+    uint64_t frag_len;
+    uint64_t names_off;  /* ntargets then nreads names, each a u32 length + bytes */
+    uint64_t names_len;
+    uint32_t ntargets;
+    uint32_t nreads;
+    uint32_t nfuncs;     /* functions defined here: such segments are never reused */
+    uint32_t reserved;
+} incr_rec_t;
+
+typedef struct {
+    char* src;
+    size_t len;
+    uint64_t hash;
+    const incr_rec_t* old;   /* cached record for the same text, if any */
+    ast_node_t* stmts;       /* parsed when the cached code cannot be used */
+    uint32_t nfuncs;         /* function definitions among stmts */
+    emit_buf_t frag;         /* freshly emitted code */
+} seg_t;
+
+typedef struct {
+    const incr_hdr_t* hdr;
+    const incr_rec_t* recs;
+    const uint8_t* blob;
+    size_t map_len;
+    size_t* table;           /* open addressing over recs, index + 1, 0 = empty */
+    size_t table_cap;
+} old_cache_t;
+
+/* --- small helpers --- */
+
+static uint32_t get_u32(const uint8_t* p) {
+    return (uint32_t) p[0] | ((uint32_t) p[1] << 8) | ((uint32_t) p[2] << 16) | ((uint32_t) p[3] << 24);
+}
+
+/* --- previous cache --- */
+
+static int old_rec_valid(const old_cache_t* c, const incr_rec_t* r) {
+    uint64_t blob_len = c->hdr->blob_len;
+    if (r->frag_off > blob_len || r->frag_len > blob_len - r->frag_off) return 0;
+    if (r->names_off > blob_len || r->names_len > blob_len - r->names_off) return 0;
+    /* the name list must parse exactly */
+    const uint8_t* p = c->blob + r->names_off;
+    uint64_t left = r->names_len;
+    for (uint64_t k = 0; k < (uint64_t) r->ntargets + r->nreads; ++k) {
+        if (left < 4) return 0;
+        uint32_t n = get_u32(p);
+        if (n > left - 4) return 0;
+        p += 4 + n;
+        left -= 4 + n;
+    }
+    return left == 0;
+}
+
+static void old_load(emitter_t* e, old_cache_t* c, const char* path) {
+    c->hdr = NULL;
+    c->table = NULL;
+    int fd = openat(AT_FDCWD, path, O_RDONLY);
+    if (fd < 0) return;
+    struct stat st;
+    if (fstat(fd, &st) < 0 || (size_t) st.st_size < sizeof(incr_hdr_t)) { close(fd); return; }
+    size_t len = (size_t) st.st_size;
+    void* map = mmap(NULL, len, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == (void*) -1) return;
+
+    const incr_hdr_t* hdr = (const incr_hdr_t*) map;
+    size_t body = len - sizeof(incr_hdr_t);
+    if (hdr->magic != INCR_MAGIC || hdr->nsegs > body / sizeof(incr_rec_t) ||
+        hdr->blob_len != body - hdr->nsegs * sizeof(incr_rec_t)) {
+        munmap(map, len);
+        return;
+    }
+    c->hdr = hdr;
+    c->recs = (const incr_rec_t*) (hdr + 1);
+    c->blob = (const uint8_t*) (c->recs + hdr->nsegs);
+    c->map_len = len;
+
+    c->table_cap = 16;
+    while (c->table_cap < hdr->nsegs * 2) c->table_cap *= 2;
+    c->table = (size_t*) e->alloc(sizeof(size_t) * c->table_cap);
+    if (!c->table) { munmap(map, len); c->hdr = NULL; return; }
+    for (size_t i = 0; i < c->table_cap; ++i) c->table[i] = 0;
+    for (size_t r = 0; r < hdr->nsegs; ++r) {
+        if (!old_rec_valid(c, &c->recs[r])) continue;
+        size_t i = (size_t) c->recs[r].hash & (c->table_cap - 1);
+        while (c->table[i]) i = (i + 1) & (c->table_cap - 1);
+        c->table[i] = r + 1;
+    }
+}
+
+static const incr_rec_t* old_find(const old_cache_t* c, uint64_t hash, size_t len) {
+    if (!c->hdr) return NULL;
+    size_t i = (size_t) hash & (c->table_cap - 1);
+    while (c->table[i]) {
+        const incr_rec_t* r = &c->recs[c->table[i] - 1];
+        if (r->hash == hash && r->src_len == len) return r;
+        i = (i + 1) & (c->table_cap - 1);
+    }
+    return NULL;
+}
+
+static void old_close(emitter_t* e, old_cache_t* c) {
+    if (c->table) e->free_fn(c->table);
+    if (c->hdr) munmap((void*) c->hdr, c->map_len);
+}
+
+/* --- segments --- */
+
+/* outside braces, every ';' ends a statement or an error-recovery skip and
+   so does the '}' closing a function body; the parser always starts fresh
+   after them, so each piece parses on its own. a function body ends at its
+   first '}', so depth 0 is never inside one */
+static int seg_boundary(const char* src, size_t i, size_t* depth) {
+    if (src[i] == '{') ++*depth;
+    else if (src[i] == '}' && *depth) return --*depth == 0;
+    return src[i] == ';' && *depth == 0;
+}
+
+static size_t split_segments(emitter_t* e, char* src, size_t len, seg_t** out) {
+    size_t n = 0, depth = 0;
+    for (size_t i = 0; i < len; ++i) n += (size_t) seg_boundary(src, i, &depth);
+    ++n;
+    seg_t* segs = (seg_t*) e->alloc(sizeof(seg_t) * n);
+    if (!segs) return 0;
+    size_t k = 0, start = 0;
+    depth = 0;
+    for (size_t i = 0; i <= len; ++i) {
+        if (i < len && !seg_boundary(src, i, &depth)) continue;
+        size_t end = i < len ? i + 1 : len;
+        if (end == start) break;
+        seg_t* s = &segs[k++];
+        s->src = src + start;
+        s->len = end - start;
+        s->hash = lfnv1a(LFNV_OFFSET, s->src, s->len);
+        s->old = NULL;
+        s->stmts = NULL;
+        s->nfuncs = 0;
+        s->frag.data = NULL; s->frag.len = 0; s->frag.cap = 0;
+        start = end;
+    }
+    *out = segs;
+    return k;
+}
+
+/* a parse error becomes the emitter's error; returns -1 then */
+static int seg_parse(emitter_t* e, seg_t* s) {
+    lmem_tag_t prev = lmem_set_tag(LMEM_TAG_PARSER);
+    lexer_t lx;
+    lexer_init(&lx, s->src, s->len);
+    parser_t p;
+    parser_init(&p, &lx, e->alloc, e->free_fn);
+    s->stmts = parser_parse_program(&p);
+    lmem_set_tag(prev);
+    for (ast_node_t* st = s->stmts; st; st = st->next) s->nfuncs += st->type == NODE_FUNC;
+    if (p.error && !e->error) e->error = p.error;
+    return p.error ? -1 : 0;
+}
+
+/* segments and every statement parsed for them */
+static void segs_free(emitter_t* e, seg_t* segs, size_t nsegs) {
+    for (size_t i = 0; i < nsegs; ++i) ast_free(segs[i].stmts, e->free_fn);
+    e->free_fn(segs);
+}
+
+static void register_name(void* ctx, const char* name, size_t len) {
+    scope_get_label((scope_t*) ctx, name, len);
+}
+
+/* walk a cached name list: skip the first `skip` names, visit the next `count` */
+static void old_names(const old_cache_t* c, const incr_rec_t* r, uint32_t skip, uint32_t count,
+                      void (*fn)(void*, const char*, size_t), void* ctx) {
+    const uint8_t* p = c->blob + r->names_off;
+    for (uint32_t k = 0; k < skip + count; ++k) {
+        uint32_t n = get_u32(p);
+        if (k >= skip) fn(ctx, (const char*) p + 4, n);
+        p += 4 + n;
+    }
+}
+
+/* name list writer for the new cache */
+typedef struct {
+    emitter_t* e;
+    emit_buf_t* blob;
+    uint32_t count;
+} name_sink_t;
+
+static void put_name(void* ctx, const char* name, size_t len) {
+    name_sink_t* ns = (name_sink_t*) ctx;
+    uint8_t l[4] = { (uint8_t) len, (uint8_t) (len >> 8), (uint8_t) (len >> 16), (uint8_t) (len >> 24) };
+    emitter_buf_write(ns->e, ns->blob, l, 4);
+    emitter_buf_write(ns->e, ns->blob, name, len);
+    ns->count++;
+}
+
+static uint64_t scope_layout(scope_t* s) {
+    uint64_t h = LFNV_OFFSET;
+    for (size_t i = 0; i < s->count; ++i) {
+        sym_entry_t* ent = scope_entry_at(s, i);
+        h = lfnv1a(h, &ent->name_len, sizeof(ent->name_len));
+        h = lfnv1a(h, ent->name, ent->name_len);
+    }
+    return h;
+}
+
+static void write_cache(emitter_t* e, const char* path, const incr_hdr_t* hdr,
+                        const incr_rec_t* recs, const emit_buf_t* blob) {
+    size_t plen = lstrlen(path);
+    char* tmp = (char*) e->alloc(plen + 5);
+    if (!tmp) return;
+    lstrcpy(tmp, path);
+    lstrcat(tmp, ".tmp");
+    int fd = openat(AT_FDCWD, tmp, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd >= 0) {
+        lwrite_all(fd, (const char*) hdr, sizeof(*hdr));
+        lwrite_all(fd, (const char*) recs, sizeof(incr_rec_t) * hdr->nsegs);
+        lwrite_all(fd, blob->data, blob->len);
+        close(fd);
+        /* atomic replace: a crash never leaves a torn cache behind */
+        rename(tmp, path);
+    }
+    e->free_fn(tmp);
+}
+
+/* what incr_prepare found, handed to incr_emit */
+struct incr {
+    emitter_t* e;
+    const char* cache_path;
+    old_cache_t old;
+    seg_t* segs;
+    size_t nsegs;
+    uint64_t layout;
+    int reuse;
+};
+
+incr_t* incr_prepare(emitter_t* e, char* src, size_t src_len, const char* cache_path) {
+    incr_t* st = (incr_t*) e->alloc(sizeof(incr_t));
+    if (!st) return NULL;
+    old_cache_t old;
+    old_load(e, &old, cache_path);
+
+    seg_t* segs = NULL;
+    size_t nsegs = split_segments(e, src, src_len, &segs);
+    if (!segs) { old_close(e, &old); e->free_fn(st); return NULL; }
+
+    /* function definitions are always parsed: calls elsewhere need them, and
+       which of their names are locals depends on the rest of the program */
+    for (size_t i = 0; i < nsegs; ++i) {
+        segs[i].old = old_find(&old, segs[i].hash, segs[i].len);
+        if (segs[i].old && segs[i].old->nfuncs) segs[i].old = NULL;
+        if (!segs[i].old && seg_parse(e, &segs[i]) != 0) {
+            segs_free(e, segs, nsegs);
+            old_close(e, &old);
+            e->free_fn(st);
+            return NULL;
+        }
+    }
+
+    /* same registration order as emitter_emit_program: every assignment
+       target in program order, then everything read, then functions */
+    for (size_t i = 0; i < nsegs; ++i) {
+        seg_t* s = &segs[i];
+        if (s->old) old_names(&old, s->old, 0, s->old->ntargets, register_name, e->scope);
+        else for (ast_node_t* st = s->stmts; st; st = st->next) emitter_stmt_targets(st, register_name, e->scope);
+    }
+    emitter_targets_done(e);
+    for (size_t i = 0; i < nsegs; ++i) {
+        seg_t* s = &segs[i];
+        if (s->old) old_names(&old, s->old, s->old->ntargets, s->old->nreads, register_name, e->scope);
+        else for (ast_node_t* st = s->stmts; st; st = st->next) emitter_stmt_reads(e, st, register_name, e->scope);
+    }
+    for (size_t i = 0; i < nsegs; ++i) {
+        if (segs[i].nfuncs) emitter_add_funcs(e, segs[i].stmts);
+    }
+    emitter_check_globals(e);
+    scope_freeze(e->scope);
+
+    /* a different variable order renumbers labels, and call sites depend on
+       the functions they call (inlined or not): either makes cached code stale */
+    uint64_t layout = scope_layout(e->scope);
+    for (size_t i = 0; i < nsegs; ++i) {
+        if (segs[i].nfuncs) layout = lfnv1a(layout, &segs[i].hash, sizeof(segs[i].hash));
+    }
+    int reuse = old.hdr && old.hdr->layout == layout;
+
+    /* everything that gets emitted afresh is checked before any output */
+    for (size_t i = 0; i < nsegs; ++i) {
+        seg_t* s = &segs[i];
+        if (s->old && reuse) continue;
+        if (!s->stmts) seg_parse(e, s);
+        emitter_check_stmts(e, s->stmts);
+    }
+    if (e->error) {
+        segs_free(e, segs, nsegs);
+        old_close(e, &old);
+        e->free_fn(st);
+        return NULL;
+    }
+
+    st->e = e;
+    st->cache_path = cache_path;
+    st->old = old;
+    st->segs = segs;
+    st->nsegs = nsegs;
+    st->layout = layout;
+    st->reuse = reuse;
+    return st;
+}
+
+int incr_emit(incr_t* st) {
+    emitter_t* e = st->e;
+    old_cache_t old = st->old;
+    seg_t* segs = st->segs;
+    size_t nsegs = st->nsegs;
+    uint64_t layout = st->layout;
+    int reuse = st->reuse;
+    const char* cache_path = st->cache_path;
+    e->free_fn(st);
+
+    incr_hdr_t hdr;
+    hdr.magic = INCR_MAGIC;
+    hdr.layout = layout;
+    hdr.nsegs = nsegs;
+    incr_rec_t* recs = (incr_rec_t*) e->alloc(sizeof(incr_rec_t) * (nsegs ? nsegs : 1));
+    emit_buf_t blob = { NULL, 0, 0 };
+    if (!recs) {
+        segs_free(e, segs, nsegs);
+        old_close(e, &old);
+        return -1;
+    }
+
+    /* fragments back to back: this run of the blob is the program body */
+    for (size_t i = 0; i < nsegs; ++i) {
+        seg_t* s = &segs[i];
+        incr_rec_t* r = &recs[i];
+        r->hash = s->hash;
+        r->src_len = s->len;
+        r->frag_off = blob.len;
+        if (s->old && reuse) {
+            emitter_buf_write(e, &blob, old.blob + s->old->frag_off, s->old->frag_len);
+        } else {
+            emitter_emit_stmts(e, s->stmts, &s->frag);
+            emitter_buf_write(e, &blob, s->frag.data, s->frag.len);
+            if (s->frag.data) e->free_fn(s->frag.data);
+        }
+        r->frag_len = blob.len - r->frag_off;
+    }
+    size_t body_len = blob.len;
+
+    for (size_t i = 0; i < nsegs; ++i) {
+        seg_t* s = &segs[i];
+        incr_rec_t* r = &recs[i];
+        r->names_off = blob.len;
+        if (s->old) {
+            emitter_buf_write(e, &blob, old.blob + s->old->names_off, s->old->names_len);
+            r->ntargets = s->old->ntargets;
+            r->nreads = s->old->nreads;
+        } else {
+            name_sink_t ns = { e, &blob, 0 };
+            for (ast_node_t* st = s->stmts; st; st = st->next) emitter_stmt_targets(st, put_name, &ns);
+            r->ntargets = ns.count;
+            ns.count = 0;
+            for (ast_node_t* st = s->stmts; st; st = st->next) emitter_stmt_reads(e, st, put_name, &ns);
+            r->nreads = ns.count;
+        }
+        r->nfuncs = s->nfuncs;
+        r->reserved = 0;
+        r->names_len = blob.len - r->names_off;
+    }
+    hdr.blob_len = blob.len;
+
+    /* preamble + body + epilogue + function bodies */
+    emit_buf_t edge = { NULL, 0, 0 };
+    e->buf = &edge;
+    emitter_emit_preamble(e);
+    e->buf = NULL;
+    emitter_write(e, edge.data, edge.len);
+    emitter_write(e, blob.data, body_len);
+    edge.len = 0;
+    e->buf = &edge;
+    emitter_emit_epilogue(e);
+    e->buf = NULL;
+    for (size_t i = 0; i < nsegs; ++i) {
+        if (segs[i].nfuncs) emitter_emit_funcs(e, segs[i].stmts, &edge);
+    }
+    emitter_write(e, edge.data, edge.len);
+
+    /* a fragment that could not be stored must not be cached as complete */
+    if (!e->out_failed) write_cache(e, cache_path, &hdr, recs, &blob);
+
+    if (edge.data) e->free_fn(edge.data);
+    if (blob.data) e->free_fn(blob.data);
+    e->free_fn(recs);
+    segs_free(e, segs, nsegs);
+    old_close(e, &old);
+    return 0;
+}
@@ -3,6 +3,10 @@
 static int is_digit(char c){return c>='0' && c<='9';}
 static int is_alpha(char c){return (c>='a'&&c<='z')||(c>='A'&&c<='Z')||c=='_';}
 static int is_alnum(char c){return is_alpha(c)||is_digit(c);}
+static int is_kw(const char* s,size_t len,const char* kw){
+    size_t i=0; while(i<len && kw[i] && s[i]==kw[i]) i++;
+    return i==len && kw[i]=='\0';
+}
 
 void lexer_init(lexer_t* lex, char* src, size_t length){ lex->src=src; lex->pos=0; lex->length=length; }
 
@@ -24,6 +28,8 @@ token_t lexer_next(lexer_t* lex){
     }
     if(is_alpha(c)){
         size_t start=lex->pos; while(lex->pos<lex->length && is_alnum(lex->src[lex->pos])) lex->pos++;
+        if(is_kw(&lex->src[start],lex->pos-start,"fn")) return (token_t){TOKEN_FN,&lex->src[start],2,0};
+        if(is_kw(&lex->src[start],lex->pos-start,"return")) return (token_t){TOKEN_RETURN,&lex->src[start],6,0};
         return (token_t){TOKEN_IDENTIFIER,&lex->src[start],lex->pos-start,0};
     }
 
@@ -39,6 +45,7 @@ token_t lexer_next(lexer_t* lex){
         case ')': return (token_t){TOKEN_RPAREN,&lex->src[lex->pos-1],1,0};
         case '{': return (token_t){TOKEN_LBRACE,&lex->src[lex->pos-1],1,0};
         case '}': return (token_t){TOKEN_RBRACE,&lex->src[lex->pos-1],1,0};
+        case ',': return (token_t){TOKEN_COMMA,&lex->src[lex->pos-1],1,0};
         default: return (token_t){TOKEN_UNKNOWN,&lex->src[lex->pos-1],1,0};
     }
 }
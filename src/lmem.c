@@ -1,31 +1,49 @@
 #define _GNU_SOURCE
 #include <unistd.h>
 #include "lmem.h"
+#include "lstr.h"
 #include <sys/mman.h>
 
 typedef struct lblock {
     size_t size;
     struct lblock* next;
+#ifdef LMEM_TRACE
+    size_t tag;
+    uintptr_t site;  /* return address of the allocating call */
+#endif
     uint8_t data[];
 } lblock_t;
 
 static lblock_t* heap_head = NULL;
 
-void* lmalloc(size_t sz) {
+static lblock_t* block_map(size_t sz) {
     size_t total = sizeof(lblock_t) + sz;
     lblock_t* block = mmap(0, total, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
     if (block == (void*)-1) return NULL;
     block->size = sz;
-    block->next = heap_head;
-    heap_head = block;
-    return block->data;
+    /* lock-free push: parallel emitter workers allocate concurrently */
+    lblock_t* head = __atomic_load_n(&heap_head, __ATOMIC_RELAXED);
+    do { block->next = head; }
+    while (!__atomic_compare_exchange_n(&heap_head, &head, block, 1, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+    return block;
+}
+
+static void block_unmap(lblock_t* block) {
+    lblock_t* self = block;
+    __atomic_compare_exchange_n(&heap_head, &self, block->next, 0, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED);
+    munmap(block, sizeof(lblock_t) + block->size);
+}
+
+#ifndef LMEM_TRACE
+
+void* lmalloc(size_t sz) {
+    lblock_t* block = block_map(sz);
+    return block ? block->data : NULL;
 }
 
 void lfree(void* ptr) {
     if (!ptr) return;
-    lblock_t* block = (lblock_t*)((uint8_t*)ptr - offsetof(lblock_t, data));
-    if (block->next == heap_head) heap_head = block->next;
-    munmap(block, sizeof(lblock_t) + block->size);
+    block_unmap((lblock_t*)((uint8_t*)ptr - offsetof(lblock_t, data)));
 }
 
 void* lrealloc(void* ptr, size_t new_sz) {
@@ -38,7 +56,322 @@ void* lrealloc(void* ptr, size_t new_sz) {
     return new_mem;
 }
 
+#else /* LMEM_TRACE */
+
+#define HIST_BUCKETS 24   /* bucket b holds sizes in (2^(b-1), 2^b], the last one everything larger */
+#define MAX_SITES 32
+
+typedef struct {
+    uint64_t allocs, frees;
+    uint64_t live_bytes, peak_bytes, total_bytes;
+    uint64_t hist[HIST_BUCKETS];
+} tag_stats_t;
+
+/* every block address ever handed out; freed ones stay as FREED to tell
+   a double free apart from a free of a pointer we never returned */
+enum { SLOT_EMPTY, SLOT_LIVE, SLOT_FREED };
+typedef struct {
+    uintptr_t addr;
+    uintptr_t state;
+} live_slot_t;
+
+static const char* tag_names[LMEM_TAG_COUNT] = {
+    "misc", "parser", "scope.name", "scope.label", "scope.table", "emit", "thread.stack"
+};
+
+static tag_stats_t stats[LMEM_TAG_COUNT];
+static uint64_t live_total, peak_total;
+static uint64_t double_frees, invalid_frees;
+static live_slot_t* slots;
+static size_t slot_cap, slot_used;
+static lmem_tag_t cur_tag = LMEM_TAG_MISC;
+static volatile char trace_lock;
+
+static void lock(void) { while (__atomic_test_and_set(&trace_lock, __ATOMIC_ACQUIRE)) {} }
+static void unlock(void) { __atomic_clear(&trace_lock, __ATOMIC_RELEASE); }
+
+/* the tracer's own tables bypass lmalloc so they never show up in the profile */
+static void* raw_map(size_t sz) {
+    void* p = mmap(0, sz, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    return p == (void*)-1 ? NULL : p;
+}
+
+static size_t slot_hash(uintptr_t a) { return (size_t)((a >> 12) * 0x9e3779b97f4a7c15ULL); }
+
+static live_slot_t* slot_find(uintptr_t addr, int insert) {
+    if (!slots) return NULL;
+    size_t i = slot_hash(addr) & (slot_cap - 1);
+    while (slots[i].state != SLOT_EMPTY) {
+        if (slots[i].addr == addr) return &slots[i];
+        i = (i + 1) & (slot_cap - 1);
+    }
+    if (!insert) return NULL;
+    slots[i].addr = addr;
+    slot_used++;
+    return &slots[i];
+}
+
+static int slots_reserve(void) {
+    if (slots && (slot_used + 1) * 2 <= slot_cap) return 0;
+    size_t newcap = slot_cap ? slot_cap * 2 : 1024;
+    live_slot_t* old = slots;
+    size_t oldcap = slot_cap;
+    slots = (live_slot_t*) raw_map(sizeof(live_slot_t) * newcap);
+    if (!slots) { slots = old; return -1; }
+    slot_cap = newcap;
+    slot_used = 0;
+    for (size_t i = 0; i < oldcap; ++i) {
+        if (old[i].state == SLOT_EMPTY) continue;
+        slot_find(old[i].addr, 1)->state = old[i].state;
+    }
+    if (old) munmap(old, sizeof(live_slot_t) * oldcap);
+    return 0;
+}
+
+static int hist_bucket(size_t sz) {
+    int b = 0;
+    while (b < HIST_BUCKETS - 1 && ((size_t)1 << b) < sz) ++b;
+    return b;
+}
+
+lmem_tag_t lmem_set_tag(lmem_tag_t tag) {
+    lmem_tag_t prev = cur_tag;
+    cur_tag = tag;
+    return prev;
+}
+
+static void* block_alloc(size_t sz, lmem_tag_t tag, uintptr_t site) {
+    lblock_t* block = block_map(sz);
+    if (!block) return NULL;
+    block->tag = tag;
+    block->site = site;
+
+    lock();
+    if (slots_reserve() == 0) slot_find((uintptr_t) block, 1)->state = SLOT_LIVE;
+    tag_stats_t* st = &stats[tag];
+    st->allocs++;
+    st->total_bytes += sz;
+    st->live_bytes += sz;
+    if (st->live_bytes > st->peak_bytes) st->peak_bytes = st->live_bytes;
+    st->hist[hist_bucket(sz)]++;
+    live_total += sz;
+    if (live_total > peak_total) peak_total = live_total;
+    unlock();
+    return block->data;
+}
+
+static void report_bad_free(const char* what, void* ptr, uintptr_t site) {
+    char msg[128];
+    lstrcpy(msg, "lmem: ");
+    lstrcat(msg, what);
+    lstrcat(msg, " of 0x");
+    size_t n = lstrlen(msg);
+    for (int i = 0; i < 16; ++i) msg[n++] = "0123456789abcdef"[((uintptr_t) ptr >> (60 - 4 * i)) & 0xf];
+    lstrcpy(msg + n, " from 0x");
+    n = lstrlen(msg);
+    for (int i = 0; i < 16; ++i) msg[n++] = "0123456789abcdef"[(site >> (60 - 4 * i)) & 0xf];
+    msg[n++] = '\n';
+    (void)write(2, msg, n);
+}
+
+/* returns 0 if the block may be unmapped */
+static int trace_free(lblock_t* block, uintptr_t site) {
+    lock();
+    live_slot_t* slot = slot_find((uintptr_t) block, 0);
+    if (!slot || slot->state != SLOT_LIVE) {
+        int dbl = slot != NULL;
+        if (dbl) double_frees++;
+        else invalid_frees++;
+        unlock();
+        report_bad_free(dbl ? "double free" : "invalid free", block->data, site);
+        return -1;
+    }
+    slot->state = SLOT_FREED;
+    tag_stats_t* st = &stats[block->tag];
+    st->frees++;
+    st->live_bytes -= block->size;
+    live_total -= block->size;
+    unlock();
+    return 0;
+}
+
+void* lmalloc(size_t sz) {
+    return block_alloc(sz, cur_tag, (uintptr_t) __builtin_return_address(0));
+}
+
+void lfree(void* ptr) {
+    if (!ptr) return;
+    lblock_t* block = (lblock_t*)((uint8_t*)ptr - offsetof(lblock_t, data));
+    if (trace_free(block, (uintptr_t) __builtin_return_address(0)) == 0) block_unmap(block);
+}
+
+void* lrealloc(void* ptr, size_t new_sz) {
+    uintptr_t site = (uintptr_t) __builtin_return_address(0);
+    if (!ptr) return block_alloc(new_sz, cur_tag, site);
+    lblock_t* block = (lblock_t*)((uint8_t*)ptr - offsetof(lblock_t, data));
+    /* check before touching the header of a block that may be gone */
+    lock();
+    live_slot_t* slot = slot_find((uintptr_t) block, 0);
+    int live = slot && slot->state == SLOT_LIVE;
+    unlock();
+    if (!live) { trace_free(block, site); return NULL; }
+    void* new_mem = block_alloc(new_sz, (lmem_tag_t) block->tag, site);
+    if (!new_mem) return NULL;
+    size_t copy_sz = block->size < new_sz ? block->size : new_sz;
+    for (size_t i=0;i<copy_sz;i++) ((uint8_t*)new_mem)[i]=((uint8_t*)ptr)[i];
+    if (trace_free(block, site) == 0) block_unmap(block);
+    return new_mem;
+}
+
+/* --- report --- */
+
+typedef struct {
+    int fd;
+    char buf[512];
+    size_t len;
+} rep_t;
+
+static void rep_flush(rep_t* r) {
+    size_t off = 0;
+    while (off < r->len) {
+        ssize_t wr = write(r->fd, r->buf + off, r->len - off);
+        if (wr <= 0) break;
+        off += (size_t) wr;
+    }
+    r->len = 0;
+}
+
+static void rep_str(rep_t* r, const char* s) {
+    for (; *s; ++s) {
+        if (r->len == sizeof(r->buf)) rep_flush(r);
+        r->buf[r->len++] = *s;
+    }
+}
+
+/* right-aligned in width columns */
+static void rep_u64(rep_t* r, uint64_t v, int width) {
+    char tmp[24];
+    int n = 0;
+    do { tmp[n++] = '0' + (char)(v % 10); v /= 10; } while (v);
+    for (int i = n; i < width; ++i) rep_str(r, " ");
+    char out[24];
+    for (int i = 0; i < n; ++i) out[i] = tmp[n - 1 - i];
+    out[n] = '\0';
+    rep_str(r, out);
+}
+
+static void rep_hex(rep_t* r, uintptr_t v) {
+    char out[19];
+    out[0] = '0'; out[1] = 'x';
+    for (int i = 0; i < 16; ++i) out[2 + i] = "0123456789abcdef"[(v >> (60 - 4 * i)) & 0xf];
+    out[18] = '\0';
+    rep_str(r, out);
+}
+
+static void rep_name(rep_t* r, const char* s, size_t width) {
+    rep_str(r, s);
+    for (size_t i = lstrlen(s); i < width; ++i) rep_str(r, " ");
+}
+
+typedef struct {
+    uintptr_t site;
+    uint64_t blocks, bytes;
+    size_t tag;
+} site_stats_t;
+
+void lmem_report(int fd) {
+    rep_t r;
+    r.fd = fd;
+    r.len = 0;
+
+    lock();
+    rep_str(&r, "lmem heap profile\n");
+    rep_str(&r, "tag             allocs    frees   live bytes   peak bytes  total bytes\n");
+    for (int t = 0; t < LMEM_TAG_COUNT; ++t) {
+        tag_stats_t* st = &stats[t];
+        if (st->allocs == 0) continue;
+        rep_name(&r, tag_names[t], 12);
+        rep_u64(&r, st->allocs, 10);
+        rep_u64(&r, st->frees, 9);
+        rep_u64(&r, st->live_bytes, 13);
+        rep_u64(&r, st->peak_bytes, 13);
+        rep_u64(&r, st->total_bytes, 13);
+        rep_str(&r, "\n");
+    }
+    rep_str(&r, "total live ");
+    rep_u64(&r, live_total, 0);
+    rep_str(&r, " bytes, peak ");
+    rep_u64(&r, peak_total, 0);
+    rep_str(&r, " bytes\n");
+
+    rep_str(&r, "size histogram (bucket <= bytes: allocs)\n");
+    for (int t = 0; t < LMEM_TAG_COUNT; ++t) {
+        if (stats[t].allocs == 0) continue;
+        rep_name(&r, tag_names[t], 12);
+        for (int b = 0; b < HIST_BUCKETS; ++b) {
+            if (stats[t].hist[b] == 0) continue;
+            rep_str(&r, b == HIST_BUCKETS - 1 ? " >" : " ");
+            rep_u64(&r, (uint64_t)1 << (b == HIST_BUCKETS - 1 ? b - 1 : b), 0);
+            rep_str(&r, ":");
+            rep_u64(&r, stats[t].hist[b], 0);
+        }
+        rep_str(&r, "\n");
+    }
+
+    /* blocks still live, grouped by allocating call site, largest first */
+    site_stats_t sites[MAX_SITES];
+    size_t nsites = 0;
+    uint64_t leak_blocks = 0, leak_bytes = 0;
+    for (size_t i = 0; i < slot_cap; ++i) {
+        if (slots[i].state != SLOT_LIVE) continue;
+        lblock_t* b = (lblock_t*) slots[i].addr;
+        leak_blocks++;
+        leak_bytes += b->size;
+        size_t k = 0;
+        while (k < nsites && (sites[k].site != b->site || sites[k].tag != b->tag)) ++k;
+        if (k == nsites) {
+            if (nsites == MAX_SITES) continue;
+            sites[k].site = b->site; sites[k].tag = b->tag;
+            sites[k].blocks = 0; sites[k].bytes = 0;
+            nsites++;
+        }
+        sites[k].blocks++;
+        sites[k].bytes += b->size;
+    }
+    rep_str(&r, "live at exit: ");
+    rep_u64(&r, leak_blocks, 0);
+    rep_str(&r, " blocks, ");
+    rep_u64(&r, leak_bytes, 0);
+    rep_str(&r, " bytes\n");
+    for (size_t i = 1; i < nsites; ++i) {
+        site_stats_t v = sites[i];
+        size_t j = i;
+        while (j > 0 && sites[j - 1].bytes < v.bytes) { sites[j] = sites[j - 1]; --j; }
+        sites[j] = v;
+    }
+    for (size_t i = 0; i < nsites; ++i) {
+        rep_str(&r, "  ");
+        rep_hex(&r, sites[i].site);
+        rep_str(&r, " ");
+        rep_name(&r, tag_names[sites[i].tag], 12);
+        rep_u64(&r, sites[i].blocks, 9);
+        rep_str(&r, " blocks");
+        rep_u64(&r, sites[i].bytes, 13);
+        rep_str(&r, " bytes\n");
+    }
+    if (double_frees || invalid_frees) {
+        rep_str(&r, "bad frees: ");
+        rep_u64(&r, double_frees, 0);
+        rep_str(&r, " double, ");
+        rep_u64(&r, invalid_frees, 0);
+        rep_str(&r, " invalid\n");
+    }
+    unlock();
+    rep_flush(&r);
+}
+
+#endif /* LMEM_TRACE */
+
 void lmemset(void* ptr, uint8_t value, size_t sz) {
     for (size_t i=0;i<sz;i++) ((uint8_t*)ptr)[i]=value;
 }
-
@@ -1,5 +1,7 @@
 #include "lstr.h"
 
+#include <unistd.h>
+
 size_t lstrlen(const char* s) {
     size_t len=0; while(s[len]!='\0') len++; return len;
 }
@@ -32,3 +34,25 @@ void litoa(int value, char* buf) {
     buf[i]='\0';
 }
 
+int latoi(const char* s) {
+    int i=0; int neg=0; int v=0;
+    if(s[0]=='-'){ neg=1; i++; }
+    while(s[i]>='0' && s[i]<='9'){ v=v*10+(s[i]-'0'); i++; }
+    return neg ? -v : v;
+}
+
+uint64_t lfnv1a(uint64_t h, const void* data, size_t len) {
+    const unsigned char* p=(const unsigned char*)data;
+    for(size_t i=0;i<len;i++){ h^=p[i]; h*=0x100000001b3ULL; }
+    return h;
+}
+
+int lwrite_all(int fd, const char* buf, size_t len) {
+    size_t off=0;
+    while(off<len){
+        ssize_t wr=write(fd, buf+off, len-off);
+        if(wr<=0) return -1;
+        off+=(size_t)wr;
+    }
+    return 0;
+}
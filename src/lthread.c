@@ -0,0 +1,42 @@
+#include "lthread.h"
+#include <stdint.h>
+
+/* syscall wrappers from start.s */
+long clone_thread(int (*fn)(void*), void* arg, void* stack_top, volatile int* tid);
+long futex(volatile int* uaddr, int op, int val, void* timeout);
+long sched_getaffinity(int pid, size_t len, void* mask);
+
+#define FUTEX_WAIT 0
+
+int lthread_alloc(lthread_t* t, void* (*alloc)(size_t)) {
+    t->tid = 0;
+    t->stack = alloc(LTHREAD_STACK_SIZE);
+    return t->stack ? 0 : -1;
+}
+
+int lthread_start(lthread_t* t, int (*fn)(void*), void* arg) {
+    long r = clone_thread(fn, arg, (uint8_t*) t->stack + LTHREAD_STACK_SIZE, &t->tid);
+    if (r < 0) return -1;
+    return 0;
+}
+
+void lthread_join(lthread_t* t, void (*free_fn)(void*)) {
+    for (;;) {
+        int tid = t->tid;
+        if (tid == 0) break;
+        futex(&t->tid, FUTEX_WAIT, tid, NULL);
+    }
+    if (free_fn) free_fn(t->stack);
+    t->stack = NULL;
+}
+
+int lthread_ncpus(void) {
+    uint64_t mask[16];
+    long r = sched_getaffinity(0, sizeof(mask), mask);
+    if (r <= 0) return 1;
+    int n = 0;
+    for (long i = 0; i < r / 8; ++i) {
+        for (uint64_t m = mask[i]; m; m &= m - 1) ++n;
+    }
+    return n > 0 ? n : 1;
+}
@@ -0,0 +1,328 @@
+#include "luring.h"
+
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+/* from start.s */
+int io_uring_setup(unsigned entries, struct io_uring_params* p);
+int io_uring_enter(int fd, unsigned to_submit, unsigned min_complete, unsigned flags, const void* sig, size_t sigsz);
+
+#define LURING_EINTR 4
+#define LURING_MAX_IO (1u << 30)   /* per read/write sqe */
+
+/* raw mmap returns -errno on failure */
+static int map_failed(void* p) { return (uintptr_t) p > (uintptr_t) -4096; }
+
+static void zero_bytes(void* p, size_t n) {
+    unsigned char* q = (unsigned char*) p;
+    for (size_t i = 0; i < n; ++i) q[i] = 0;
+}
+
+int luring_init(luring_t* r, unsigned entries) {
+    struct io_uring_params p;
+    zero_bytes(&p, sizeof(p));
+    int fd = io_uring_setup(entries, &p);
+    if (fd < 0) return fd;
+
+    r->fd = fd;
+    r->sq_map_len = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+    r->cq_map_len = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+    int single = (p.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single && r->cq_map_len > r->sq_map_len) r->sq_map_len = r->cq_map_len;
+
+    r->sq_map = mmap(NULL, r->sq_map_len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+    if (map_failed(r->sq_map)) { close(fd); return -1; }
+    r->cq_map = r->sq_map;
+    if (!single) {
+        r->cq_map = mmap(NULL, r->cq_map_len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+        if (map_failed(r->cq_map)) { munmap(r->sq_map, r->sq_map_len); close(fd); return -1; }
+    }
+    r->sqe_map_len = p.sq_entries * sizeof(struct io_uring_sqe);
+    r->sqes = (struct io_uring_sqe*) mmap(NULL, r->sqe_map_len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                                          fd, IORING_OFF_SQES);
+    if (map_failed(r->sqes)) {
+        if (!single) munmap(r->cq_map, r->cq_map_len);
+        munmap(r->sq_map, r->sq_map_len);
+        close(fd);
+        return -1;
+    }
+
+    char* sq = (char*) r->sq_map;
+    char* cq = (char*) r->cq_map;
+    r->sq_head = (volatile unsigned*) (sq + p.sq_off.head);
+    r->sq_tail = (volatile unsigned*) (sq + p.sq_off.tail);
+    r->sq_mask = *(unsigned*) (sq + p.sq_off.ring_mask);
+    r->sq_entries = p.sq_entries;
+    unsigned* array = (unsigned*) (sq + p.sq_off.array);
+    for (unsigned i = 0; i < p.sq_entries; ++i) array[i] = i;
+    r->sq_local_tail = *r->sq_tail;
+    r->sq_submitted = 0;
+
+    r->cq_head = (volatile unsigned*) (cq + p.cq_off.head);
+    r->cq_tail = (volatile unsigned*) (cq + p.cq_off.tail);
+    r->cq_mask = *(unsigned*) (cq + p.cq_off.ring_mask);
+    r->cqes = (struct io_uring_cqe*) (cq + p.cq_off.cqes);
+    return 0;
+}
+
+void luring_close(luring_t* r) {
+    munmap(r->sqes, r->sqe_map_len);
+    if (r->cq_map != r->sq_map) munmap(r->cq_map, r->cq_map_len);
+    munmap(r->sq_map, r->sq_map_len);
+    close(r->fd);
+}
+
+struct io_uring_sqe* luring_sqe(luring_t* r) {
+    unsigned head = __atomic_load_n(r->sq_head, __ATOMIC_ACQUIRE);
+    if (r->sq_local_tail - head >= r->sq_entries) return NULL;
+    struct io_uring_sqe* sqe = &r->sqes[r->sq_local_tail & r->sq_mask];
+    zero_bytes(sqe, sizeof(*sqe));
+    r->sq_local_tail++;
+    return sqe;
+}
+
+int luring_submit(luring_t* r, unsigned wait_nr) {
+    r->sq_submitted += r->sq_local_tail - *r->sq_tail;
+    /* sqe contents must be visible before the kernel sees the new tail */
+    __atomic_store_n(r->sq_tail, r->sq_local_tail, __ATOMIC_RELEASE);
+    if (!r->sq_submitted && !wait_nr) return 0;
+    int ret;
+    do {
+        ret = io_uring_enter(r->fd, r->sq_submitted, wait_nr, wait_nr ? IORING_ENTER_GETEVENTS : 0, NULL, 0);
+    } while (ret == -LURING_EINTR);
+    if (ret < 0) return ret;
+    r->sq_submitted -= (unsigned) ret;
+    return 0;
+}
+
+int luring_peek(luring_t* r, uint64_t* user_data, int32_t* res) {
+    unsigned head = *r->cq_head;
+    if (head == __atomic_load_n(r->cq_tail, __ATOMIC_ACQUIRE)) return 0;
+    struct io_uring_cqe* cqe = &r->cqes[head & r->cq_mask];
+    *user_data = cqe->user_data;
+    *res = cqe->res;
+    __atomic_store_n(r->cq_head, head + 1, __ATOMIC_RELEASE);
+    return 1;
+}
+
+int luring_wait(luring_t* r, uint64_t* user_data, int32_t* res) {
+    for (;;) {
+        if (luring_peek(r, user_data, res)) return 1;
+        int ret = luring_submit(r, 1);
+        if (ret < 0) return ret;
+    }
+}
+
+/* --- sqe setup --- */
+
+void luring_prep_openat(struct io_uring_sqe* sqe, int dfd, const char* path, int flags, unsigned mode) {
+    sqe->opcode = IORING_OP_OPENAT;
+    sqe->fd = dfd;
+    sqe->addr = (uint64_t) (uintptr_t) path;
+    sqe->len = mode;
+    sqe->open_flags = (uint32_t) flags;
+}
+
+void luring_prep_statx(struct io_uring_sqe* sqe, int dfd, const char* path, int flags, unsigned mask, struct statx* out) {
+    sqe->opcode = IORING_OP_STATX;
+    sqe->fd = dfd;
+    sqe->addr = (uint64_t) (uintptr_t) path;
+    sqe->len = mask;
+    sqe->off = (uint64_t) (uintptr_t) out;
+    sqe->statx_flags = (uint32_t) flags;
+}
+
+void luring_prep_read(struct io_uring_sqe* sqe, int fd, void* buf, unsigned len, uint64_t off) {
+    sqe->opcode = IORING_OP_READ;
+    sqe->fd = fd;
+    sqe->addr = (uint64_t) (uintptr_t) buf;
+    sqe->len = len;
+    sqe->off = off;
+}
+
+void luring_prep_write(struct io_uring_sqe* sqe, int fd, const void* buf, unsigned len, uint64_t off) {
+    sqe->opcode = IORING_OP_WRITE;
+    sqe->fd = fd;
+    sqe->addr = (uint64_t) (uintptr_t) buf;
+    sqe->len = len;
+    sqe->off = off;
+}
+
+void luring_prep_close(struct io_uring_sqe* sqe, int fd) {
+    sqe->opcode = IORING_OP_CLOSE;
+    sqe->fd = fd;
+}
+
+/* --- driver I/O --- */
+
+enum { OPEN_IN = 1, STAT_IN, OPEN_OUT, READ_IN, CLOSE_IN };
+
+int luring_read_file(luring_t* r, const char* in_path, void* (*alloc)(size_t), void (*free_fn)(void*),
+                     char** src, size_t* src_len) {
+    /* open -> statx, linked: a missing input cancels the statx */
+    struct statx stx;
+    struct io_uring_sqe* sqe = luring_sqe(r);
+    luring_prep_openat(sqe, AT_FDCWD, in_path, O_RDONLY, 0);
+    sqe->flags |= IOSQE_IO_LINK;
+    sqe->user_data = OPEN_IN;
+    sqe = luring_sqe(r);
+    luring_prep_statx(sqe, AT_FDCWD, in_path, 0, STATX_SIZE, &stx);
+    sqe->user_data = STAT_IN;
+    if (luring_submit(r, 2) < 0) return -1;
+
+    int32_t res[CLOSE_IN + 1] = { 0, -1, -1, -1, -1, -1 };
+    for (int i = 0; i < 2; ++i) {
+        uint64_t ud;
+        int32_t rv;
+        if (luring_wait(r, &ud, &rv) < 0) return -1;   /* nothing can be trusted now */
+        if (ud >= OPEN_IN && ud <= STAT_IN) res[ud] = rv;
+    }
+    int in_fd = res[OPEN_IN];
+    size_t len = (size_t) stx.stx_size;
+    char* buf = NULL;
+    if (in_fd >= 0 && res[STAT_IN] == 0 && len > 0) buf = (char*) alloc(len);
+    if (!buf) {
+        if (in_fd >= 0) close(in_fd);
+        return -1;
+    }
+
+    size_t got = 0;
+    while (got < len) {
+        size_t want = len - got;
+        sqe = luring_sqe(r);
+        luring_prep_read(sqe, in_fd, buf + got, want > LURING_MAX_IO ? LURING_MAX_IO : (unsigned) want, got);
+        sqe->user_data = READ_IN;
+        uint64_t ud;
+        int32_t rv = -1;
+        if (luring_submit(r, 1) < 0 || luring_wait(r, &ud, &rv) < 0 || rv <= 0) break;
+        got += (size_t) rv;
+    }
+    if (got < len) {
+        free_fn(buf);
+        close(in_fd);
+        return -1;
+    }
+    /* nobody waits for this one: luring_create and the writer skip its completion */
+    sqe = luring_sqe(r);
+    luring_prep_close(sqe, in_fd);
+    sqe->user_data = 0;
+    luring_submit(r, 0);
+
+    *src = buf;
+    *src_len = len;
+    return 0;
+}
+
+int luring_create(luring_t* r, const char* path) {
+    struct io_uring_sqe* sqe = luring_sqe(r);
+    if (!sqe) return -1;
+    luring_prep_openat(sqe, AT_FDCWD, path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    sqe->user_data = OPEN_OUT;
+    if (luring_submit(r, 1) < 0) return -1;
+    for (;;) {
+        uint64_t ud;
+        int32_t rv;
+        if (luring_wait(r, &ud, &rv) < 0) return -1;
+        if (ud == OPEN_OUT) return rv;
+    }
+}
+
+/* --- output writer --- */
+
+typedef struct {
+    char* data;
+    size_t len;
+    size_t done;
+    uint64_t off;
+} wr_chunk_t;
+
+static void writer_queue(luring_writer_t* w, wr_chunk_t* c);
+
+static void writer_complete(luring_writer_t* w, uint64_t user_data, int32_t res) {
+    if (!user_data || user_data == (uint64_t) (uintptr_t) w) return;   /* not a write */
+    wr_chunk_t* c = (wr_chunk_t*) (uintptr_t) user_data;
+    w->inflight--;
+    if (res <= 0) w->failed = 1;
+    else {
+        c->done += (size_t) res;
+        if (c->done < c->len) { writer_queue(w, c); return; }   /* short write: the rest */
+    }
+    w->free_fn(c->data);
+    w->free_fn(c);
+}
+
+/* block for one completion */
+static void writer_reap(luring_writer_t* w) {
+    uint64_t ud;
+    int32_t res;
+    if (luring_wait(w->ring, &ud, &res) < 0) { w->failed = 1; return; }
+    writer_complete(w, ud, res);
+}
+
+static void writer_queue(luring_writer_t* w, wr_chunk_t* c) {
+    /* bounded in flight: chunk memory and the completion ring both stay small */
+    while (w->inflight >= w->ring->sq_entries && !w->failed) writer_reap(w);
+    struct io_uring_sqe* sqe = w->failed ? NULL : luring_sqe(w->ring);
+    if (!sqe) {
+        w->failed = 1;
+        w->free_fn(c->data);
+        w->free_fn(c);
+        return;
+    }
+    size_t want = c->len - c->done;
+    luring_prep_write(sqe, w->fd, c->data + c->done, want > LURING_MAX_IO ? LURING_MAX_IO : (unsigned) want,
+                      c->off + c->done);
+    sqe->user_data = (uint64_t) (uintptr_t) c;
+    w->inflight++;
+    if (luring_submit(w->ring, 0) < 0) w->failed = 1;
+}
+
+void luring_writer_init(luring_writer_t* w, luring_t* r, int fd, void* (*alloc)(size_t), void (*free_fn)(void*)) {
+    w->ring = r;
+    w->fd = fd;
+    w->off = 0;
+    w->inflight = 0;
+    w->failed = 0;
+    w->alloc = alloc;
+    w->free_fn = free_fn;
+}
+
+void luring_writer_sink(void* ctx, char* data, size_t len) {
+    luring_writer_t* w = (luring_writer_t*) ctx;
+    wr_chunk_t* c = w->failed ? NULL : (wr_chunk_t*) w->alloc(sizeof(wr_chunk_t));
+    if (!c) {
+        w->failed = 1;
+        w->free_fn(data);
+        return;
+    }
+    c->data = data;
+    c->len = len;
+    c->done = 0;
+    c->off = w->off;
+    w->off += len;
+    writer_queue(w, c);
+
+    /* retire whatever already finished so memory goes back early */
+    uint64_t ud;
+    int32_t res;
+    while (luring_peek(w->ring, &ud, &res)) writer_complete(w, ud, res);
+}
+
+int luring_writer_finish(luring_writer_t* w) {
+    while (w->inflight && !w->failed) writer_reap(w);
+    struct io_uring_sqe* sqe = w->failed ? NULL : luring_sqe(w->ring);
+    if (!sqe) {
+        close(w->fd);
+        return w->failed ? -1 : 0;
+    }
+    luring_prep_close(sqe, w->fd);
+    sqe->user_data = (uint64_t) (uintptr_t) w;
+    if (luring_submit(w->ring, 1) < 0) { close(w->fd); return -1; }
+    uint64_t ud;
+    int32_t res = -1;
+    do {
+        if (luring_wait(w->ring, &ud, &res) < 0) return -1;
+    } while (ud != (uint64_t) (uintptr_t) w);
+    return res < 0 ? -1 : 0;
+}
@@ -4,12 +4,26 @@
 #include "parser.h"
 #include "scope.h"
 #include "emit.h"
+#include "lthread.h"
+#include "incr.h"
+#include "luring.h"
+#include "superopt.h"
 
 #include <sys/mman.h>
 #include <sys/stat.h>
 #include <fcntl.h>
 #include <unistd.h>
 
+/* "msg: name\n" on stderr */
+static void report_error(const char* msg, const char* name, size_t name_len) {
+    (void)write(2, msg, lstrlen(msg));
+    if (name) {
+        (void)write(2, ": ", 2);
+        (void)write(2, name, name_len);
+    }
+    (void)write(2, "\n", 1);
+}
+
 /* minimal syscall-based read of file into mmap */
 static char* read_file_to_buffer(const char* path, size_t* out_len) {
     int fd = openat(AT_FDCWD, path, O_RDONLY);
@@ -26,52 +40,191 @@ static char* read_file_to_buffer(const char* path, size_t* out_len) {
 }
 
 int main(int argc, char** argv) {
-    if (argc < 3) {
-        const char* msg = "usage: clearsysc <input.cs> <output.s>\n";
-        (void)write(2, msg, lstrlen(msg));
-        return 1;
+    /* options first, then <input> <output> */
+    const char* in_path = NULL;
+    const char* out_path = NULL;
+    const char* prof_gen = NULL;
+    const char* prof_use = NULL;
+    const char* incr_cache = NULL;
+    int nthreads = 1;
+    const char* rewrite_db = NULL;
+    int io_uring = 0;
+    int superopt = 0;
+    for (int i = 1; i < argc; ++i) {
+        if (lstrncmp(argv[i], "-j", 2) == 0) {
+            nthreads = latoi(argv[i] + 2);
+            if (nthreads <= 0) nthreads = lthread_ncpus();
+        } else if (lstrncmp(argv[i], "-fprofile-generate=", 19) == 0) {
+            prof_gen = argv[i] + 19;
+        } else if (lstrncmp(argv[i], "-fprofile-use=", 14) == 0) {
+            prof_use = argv[i] + 14;
+        } else if (lstrncmp(argv[i], "-fincremental=", 14) == 0) {
+            incr_cache = argv[i] + 14;
+        } else if (lstrcmp(argv[i], "-fio-uring") == 0) {
+            io_uring = 1;
+        } else if (lstrncmp(argv[i], "-frewrite-db=", 13) == 0) {
+            rewrite_db = argv[i] + 13;
+        } else if (lstrcmp(argv[i], "--superopt") == 0) {
+            superopt = 1;
+        } else if (!in_path) {
+            in_path = argv[i];
+        } else if (!out_path) {
+            out_path = argv[i];
+        }
     }
-    size_t src_len = 0;
-    char* src = read_file_to_buffer(argv[1], &src_len);
-    if (!src) {
-        const char* msg = "failed to open input\n";
+    if (!in_path || !out_path) {
+        const char* msg = "usage: clearsysc [-jN] [-fprofile-generate=<file>] [-fprofile-use=<file>] [-fincremental=<cache>] [-fio-uring] [-frewrite-db=<db>] <input.cs> <output.s>\n"
+                          "       clearsysc --superopt <input.cs> <db>\n";
         (void)write(2, msg, lstrlen(msg));
         return 1;
     }
+    size_t src_len = 0;
+    char* src = NULL;
+    int outfd = -1;
 
-    /* init lexer */
-    lexer_t lx;
-    lexer_init(&lx, src, src_len);
-
-    /* init parser with lmalloc allocator */
-    parser_t p;
-    parser_init(&p, &lx, lmalloc);
+    /* input read through io_uring; anything going wrong there (including no
+       io_uring at all) falls back to the synchronous path, which also
+       reports the errors */
+    luring_t ring;
+    luring_writer_t ring_out;
+    if (io_uring && luring_init(&ring, LURING_ENTRIES) == 0) {
+        if (luring_read_file(&ring, in_path, lmalloc, lfree, &src, &src_len) != 0) {
+            luring_close(&ring);
+            io_uring = 0;
+        }
+    } else {
+        io_uring = 0;
+    }
 
-    /* parse */
-    ast_node_t* prog = parser_parse_program(&p);
+    if (!io_uring) {
+        src = read_file_to_buffer(in_path, &src_len);
+        if (!src) {
+            const char* msg = "failed to open input\n";
+            (void)write(2, msg, lstrlen(msg));
+            return 1;
+        }
+    }
 
     /* init scope */
     scope_t sc;
     scope_init(&sc, lmalloc, lfree);
 
+    /* emitter; the output is opened once the program has been accepted, so
+       a rejected program leaves an existing output alone */
+    lmem_set_tag(LMEM_TAG_EMIT);
+    emitter_t em;
+    emitter_init(&em, -1, &sc, lmalloc, lfree);
+    emitter_set_threads(&em, nthreads);
+
+    if (incr_cache && (prof_gen || prof_use || rewrite_db || superopt)) {
+        /* cached code cannot carry counters, profile-driven layout or rewrites */
+        const char* msg = "warning: -fincremental ignored with profile, rewrite or superopt options\n";
+        (void)write(2, msg, lstrlen(msg));
+        incr_cache = NULL;
+    }
+
+    /* profile and rewrite db, mapped until emission is over */
+    size_t prof_len = 0;
+    char* prof = NULL;
+    size_t db_len = 0;
+    char* db = NULL;
+    incr_t* incr = NULL;
+    ast_node_t* prog = NULL;
+
+    if (incr_cache) {
+        incr = incr_prepare(&em, src, src_len, incr_cache);
+        if (!incr) {
+            if (em.error) report_error(em.error, em.error_name, em.error_name_len);
+            else report_error("incremental compile failed", NULL, 0);
+            return 1;
+        }
+    } else {
+        /* init lexer */
+        lexer_t lx;
+        lexer_init(&lx, src, src_len);
+
+        /* init parser with lmalloc allocator */
+        lmem_tag_t prev_tag = lmem_set_tag(LMEM_TAG_PARSER);
+        parser_t p;
+        parser_init(&p, &lx, lmalloc, lfree);
+
+        /* parse */
+        prog = parser_parse_program(&p);
+        lmem_set_tag(prev_tag);
+        if (p.error) {
+            report_error(p.error, NULL, 0);
+            return 1;
+        }
+
+        if (prof_gen) emitter_instrument(&em, prof_gen);
+        prof = prof_use ? read_file_to_buffer(prof_use, &prof_len) : NULL;
+        if (prof_use && !prof) {
+            const char* msg = "warning: failed to read profile, ignoring it\n";
+            (void)write(2, msg, lstrlen(msg));
+        }
+        if (prof) emitter_use_profile(&em, prof, prof_len);
+        db = rewrite_db ? read_file_to_buffer(rewrite_db, &db_len) : NULL;
+        if (rewrite_db && !db) {
+            const char* msg = "warning: failed to read rewrite db, ignoring it\n";
+            (void)write(2, msg, lstrlen(msg));
+        }
+        if (db) emitter_use_rewrites(&em, db, db_len);
+        /* --superopt writes the rewrite db for the program instead of code */
+        if (!superopt && emitter_prepare_program(&em, prog) != 0) {
+            report_error(em.error, em.error_name, em.error_name_len);
+            return 1;
+        }
+    }
+
     /* open output file for assembly */
-    int outfd = openat(AT_FDCWD, argv[2], O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    outfd = io_uring ? luring_create(&ring, out_path) : openat(AT_FDCWD, out_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
     if (outfd < 0) {
         const char* msg = "failed to open output\n";
         (void)write(2, msg, lstrlen(msg));
         return 1;
     }
+    em.out_fd = outfd;
+    if (io_uring) {
+        /* output chunks are written while later ones are still being emitted */
+        luring_writer_init(&ring_out, &ring, outfd, lmalloc, lfree);
+        emitter_set_sink(&em, luring_writer_sink, &ring_out);
+    }
 
-    /* emitter */
-    emitter_t em;
-    emitter_init(&em, outfd, &sc, lmalloc, lfree);
-    emitter_emit_program(&em, prog);
+    if (incr) {
+        if (incr_emit(incr) != 0) {
+            report_error("incremental compile failed", NULL, 0);
+            return 1;
+        }
+    } else if (superopt) {
+        superopt_run(prog, outfd, lmalloc, lfree);
+    } else {
+        emitter_emit_prepared(&em, prog);
+    }
+    if (prof) munmap(prof, prof_len);
     emitter_close(&em);
+    if (db) munmap(db, db_len);
 
-    close(outfd);
+    /* dropped output (a buffer that could not grow, a failed write) must not
+       pass for a complete program */
+    int failed = em.out_failed;
+    if (io_uring) {
+        failed |= luring_writer_finish(&ring_out);
+        luring_close(&ring);
+        lfree(src);
+    } else {
+        close(outfd);
+
+        /* munmap source */
+        munmap(src, src_len);
+    }
+    if (failed) {
+        const char* msg = "failed to write output\n";
+        (void)write(2, msg, lstrlen(msg));
+        return 1;
+    }
 
-    /* munmap source */
-    munmap(src, src_len);
+    /* heap profile on stderr (LMEM_TRACE builds only) */
+    lmem_report(2);
 
     return 0;
 }
@@ -13,15 +13,22 @@ static ast_node_t* new_node(parser_t* p) {
     return n;
 }
 
-void parser_init(parser_t* p, lexer_t* lex, void* (*alloc_fn)(size_t)) {
+void parser_init(parser_t* p, lexer_t* lex, void* (*alloc_fn)(size_t), void (*free_fn)(void*)) {
     p->lex = lex;
     p->alloc = alloc_fn;
+    p->free_fn = free_fn;
+    p->error = NULL;
     p->cur = lexer_next(lex);
 }
 
 /* advance token */
 static void advance(parser_t* p) { p->cur = lexer_next(p->lex); }
 
+/* record an error that makes the program unusable; the first one is kept */
+static void parse_error(parser_t* p, const char* msg) {
+    if (!p->error) p->error = msg;
+}
+
 static int token_is_binop(token_type_t t) {
     return t == TOKEN_PLUS || t == TOKEN_MINUS || t == TOKEN_STAR || t == TOKEN_SLASH;
 }
@@ -37,7 +44,37 @@ static binop_type_t token_to_binop(token_type_t t) {
     }
 }
 
-/* parse factor: INT | IDENT */
+static ast_node_t* parse_expression(parser_t* p);
+
+/* parse call arguments; cur is the '(' after the callee name.
+   on a malformed list (a ',' not followed by an argument, no closing ')')
+   p->error is set, the call is returned as parsed so far and the offending
+   token is left for the caller */
+static ast_node_t* parse_call(parser_t* p, token_t id) {
+    ast_node_t* n = new_node(p);
+    n->type = NODE_CALL;
+    n->name = id.start;
+    n->name_len = id.length;
+    advance(p);
+    if (p->cur.type == TOKEN_RPAREN) { advance(p); return n; }
+    ast_node_t* tail = NULL;
+    for (;;) {
+        ast_node_t* arg = parse_expression(p);
+        if (!arg) {
+            parse_error(p, tail ? "missing argument after ','" : "missing ')' after arguments");
+            return n;
+        }
+        if (!tail) n->left = arg;
+        else tail->next = arg;
+        tail = arg;
+        if (p->cur.type == TOKEN_COMMA) { advance(p); continue; }
+        if (p->cur.type == TOKEN_RPAREN) advance(p);
+        else parse_error(p, "missing ')' after arguments");
+        return n;
+    }
+}
+
+/* parse factor: INT | IDENT | IDENT '(' args ')' */
 static ast_node_t* parse_factor(parser_t* p) {
     token_t t = p->cur;
     if (t.type == TOKEN_INT) {
@@ -48,11 +85,12 @@ static ast_node_t* parse_factor(parser_t* p) {
         return n;
     }
     if (t.type == TOKEN_IDENTIFIER) {
+        advance(p);
+        if (p->cur.type == TOKEN_LPAREN) return parse_call(p, t);
         ast_node_t* n = new_node(p);
         n->type = NODE_VAR;
         n->name = t.start;
         n->name_len = t.length;
-        advance(p);
         return n;
     }
     return NULL;
@@ -91,11 +129,16 @@ static ast_node_t* parse_expression(parser_t* p) {
     return node;
 }
 
-/* parse assignment: IDENT '=' expression ';' */
+/* parse assignment: IDENT '=' expression ';'  (or a call statement: IDENT '(' args ')' ';') */
 static ast_node_t* parse_assignment(parser_t* p) {
     if (p->cur.type != TOKEN_IDENTIFIER) return NULL;
     token_t id = p->cur;
     advance(p);
+    if (p->cur.type == TOKEN_LPAREN) {
+        ast_node_t* call = parse_call(p, id);
+        if (p->cur.type == TOKEN_SEMICOLON) advance(p);
+        return call;
+    }
     if (p->cur.type != TOKEN_ASSIGN) return NULL;
     advance(p);
     ast_node_t* expr = parse_expression(p);
@@ -111,12 +154,77 @@ static ast_node_t* parse_assignment(parser_t* p) {
     return n;
 }
 
-/* parse single statement (for now only assignments) */
+/* parse return: 'return' [expression] ';' */
+static ast_node_t* parse_return(parser_t* p) {
+    advance(p);
+    ast_node_t* n = new_node(p);
+    n->type = NODE_RETURN;
+    n->left = parse_expression(p);
+    if (p->cur.type == TOKEN_SEMICOLON) advance(p);
+    return n;
+}
+
+static ast_node_t* parse_statement(parser_t* p);
+
+/* parse function: 'fn' IDENT '(' [IDENT {',' IDENT}] ')' '{' {statement} '}'.
+   a bad header returns NULL with the offending token as the current one;
+   everything before it (fn, name, params) is consumed, and the caller's
+   recovery skips the offending token too. once inside the body everything
+   up to the matching '}' belongs to it. a nested definition is parsed (to
+   stay in sync) but dropped, and sets p->error */
+static ast_node_t* parse_function(parser_t* p) {
+    advance(p);
+    if (p->cur.type != TOKEN_IDENTIFIER) return NULL;
+    token_t id = p->cur;
+    advance(p);
+    if (p->cur.type != TOKEN_LPAREN) return NULL;
+    advance(p);
+
+    ast_node_t* n = new_node(p);
+    n->type = NODE_FUNC;
+    n->name = id.start;
+    n->name_len = id.length;
+
+    ast_node_t* tail = NULL;
+    while (p->cur.type == TOKEN_IDENTIFIER) {
+        ast_node_t* param = new_node(p);
+        param->type = NODE_VAR;
+        param->name = p->cur.start;
+        param->name_len = p->cur.length;
+        if (!tail) n->left = param;
+        else tail->next = param;
+        tail = param;
+        advance(p);
+        if (p->cur.type != TOKEN_COMMA) break;
+        advance(p);
+    }
+    if (p->cur.type != TOKEN_RPAREN) { parser_free_ast(p, n); return NULL; }
+    advance(p);
+    if (p->cur.type != TOKEN_LBRACE) { parser_free_ast(p, n); return NULL; }
+    advance(p);
+
+    tail = NULL;
+    while (p->cur.type != TOKEN_RBRACE && p->cur.type != TOKEN_EOF) {
+        if (p->cur.type == TOKEN_FN) parse_error(p, "nested function definition");
+        ast_node_t* stmt = parse_statement(p);
+        if (!stmt) { advance(p); continue; }
+        if (stmt->type == NODE_FUNC) { parser_free_ast(p, stmt); continue; }
+        if (!tail) n->right = stmt;
+        else tail->next = stmt;
+        tail = stmt;
+    }
+    if (p->cur.type == TOKEN_RBRACE) advance(p);
+    return n;
+}
+
+/* parse single statement: assignment, call, return or function definition */
 static ast_node_t* parse_statement(parser_t* p) {
-    if (p->cur.type == TOKEN_IDENTIFIER) {
-        return parse_assignment(p);
+    switch (p->cur.type) {
+        case TOKEN_IDENTIFIER: return parse_assignment(p);
+        case TOKEN_RETURN: return parse_return(p);
+        case TOKEN_FN: return parse_function(p);
+        default: return NULL;
     }
-    return NULL;
 }
 
 ast_node_t* parser_parse_program(parser_t* p) {
@@ -136,7 +244,16 @@ ast_node_t* parser_parse_program(parser_t* p) {
 }
 
 void parser_free_ast(parser_t* p, ast_node_t* root) {
-    /* minimal: lfree not used here; user can extend if needed */
-    (void)p; (void)root;
+    ast_free(root, p->free_fn);
+}
+
+void ast_free(ast_node_t* root, void (*free_fn)(void*)) {
+    while (root) {
+        ast_node_t* next = root->next;
+        ast_free(root->left, free_fn);
+        ast_free(root->right, free_fn);
+        free_fn(root);
+        root = next;
+    }
 }
 
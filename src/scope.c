@@ -1,10 +1,13 @@
 #include "scope.h"
 #include "lstr.h"
+#include "lmem.h"
 #include <stddef.h>
 
 /* helper to duplicate identifier into nul-terminated string via allocator */
 static char* dup_ident(scope_t* s, const char* src, size_t len) {
+    lmem_tag_t prev = lmem_set_tag(LMEM_TAG_SCOPE_NAME);
     char* d = (char*) s->alloc(len + 1);
+    lmem_set_tag(prev);
     for (size_t i=0;i<len;i++) d[i] = src[i];
     d[len] = '\0';
     return d;
@@ -28,7 +31,9 @@ static char* make_label(scope_t* s) {
 
     /* label prefix "v_" + digits */
     size_t prelen = 2;
+    lmem_tag_t prev = lmem_set_tag(LMEM_TAG_SCOPE_LABEL);
     char* out = (char*) s->alloc(prelen + lstrlen(buf) + 1);
+    lmem_set_tag(prev);
     out[0] = 'v'; out[1] = '_';
     size_t j = 0;
     while (buf[j]) { out[prelen + j] = buf[j]; ++j; }
@@ -39,43 +44,74 @@ static char* make_label(scope_t* s) {
 void scope_init(scope_t* s, void* (*alloc)(size_t), void (*free_fn)(void*)) {
     s->alloc = alloc;
     s->free_fn = free_fn;
+    lmem_tag_t prev = lmem_set_tag(LMEM_TAG_SCOPE_TABLE);
     s->entries = (sym_entry_t*) alloc(sizeof(sym_entry_t) * 8);
+    lmem_set_tag(prev);
     s->count = 0;
     s->cap = 8;
     s->next_id = 0;
+    s->parent = NULL;
+    s->frozen = 0;
     /* zero entries */
-    for (size_t i=0;i<s->cap;i++){ s->entries[i].name = NULL; s->entries[i].label = NULL; s->entries[i].name_len = 0; }
+    for (size_t i=0;i<s->cap;i++){ s->entries[i].name = NULL; s->entries[i].label = NULL; s->entries[i].name_len = 0; s->entries[i].reg = NULL; }
 }
 
-char* scope_get_label(scope_t* s, const char* name, size_t name_len) {
+void scope_init_nested(scope_t* s, scope_t* parent) {
+    scope_init(s, parent->alloc, parent->free_fn);
+    s->parent = parent;
+}
+
+sym_entry_t* scope_get_entry(scope_t* s, const char* name, size_t name_len) {
     /* search */
     for (size_t i=0;i<s->count;i++) {
         if (s->entries[i].name_len == name_len) {
             if (lstrncmp(s->entries[i].name, name, name_len) == 0) {
-                return s->entries[i].label;
+                return &s->entries[i];
             }
         }
     }
+    if (s->frozen) return NULL;
     /* create */
     if (s->count >= s->cap) {
         size_t newcap = s->cap * 2;
+        lmem_tag_t prev = lmem_set_tag(LMEM_TAG_SCOPE_TABLE);
         sym_entry_t* newarr = (sym_entry_t*) s->alloc(sizeof(sym_entry_t) * newcap);
+        lmem_set_tag(prev);
         /* copy */
         for (size_t i=0;i<s->count;i++) newarr[i] = s->entries[i];
         /* initialize rest */
-        for (size_t i=s->count;i<newcap;i++) { newarr[i].name = NULL; newarr[i].label = NULL; newarr[i].name_len = 0; }
+        for (size_t i=s->count;i<newcap;i++) { newarr[i].name = NULL; newarr[i].label = NULL; newarr[i].name_len = 0; newarr[i].reg = NULL; }
         s->entries = newarr;
         s->cap = newcap;
     }
     char* ncpy = dup_ident(s, name, name_len);
-    char* lbl = make_label(s);
+    char* lbl = s->parent ? NULL : make_label(s);
     s->entries[s->count].name = ncpy;
     s->entries[s->count].name_len = name_len;
     s->entries[s->count].label = lbl;
-    s->count++;
-    return lbl;
+    s->entries[s->count].reg = NULL;
+    s->entries[s->count].slot = s->count;
+    return &s->entries[s->count++];
+}
+
+sym_entry_t* scope_find(scope_t* s, const char* name, size_t name_len) {
+    for (; s; s = s->parent) {
+        for (size_t i=0;i<s->count;i++) {
+            if (s->entries[i].name_len == name_len && lstrncmp(s->entries[i].name, name, name_len) == 0) {
+                return &s->entries[i];
+            }
+        }
+    }
+    return NULL;
+}
+
+char* scope_get_label(scope_t* s, const char* name, size_t name_len) {
+    sym_entry_t* ent = scope_get_entry(s, name, name_len);
+    return ent ? ent->label : NULL;
 }
 
+void scope_freeze(scope_t* s) { s->frozen = 1; }
+
 sym_entry_t* scope_entry_at(scope_t* s, size_t idx) {
     if (idx >= s->count) return NULL;
     return &s->entries[idx];
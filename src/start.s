@@ -10,6 +10,13 @@
 .global munmap
 .global brk
 .global exit_group
+.global writev
+.global futex
+.global sched_getaffinity
+.global clone_thread
+.global rename
+.global io_uring_setup
+.global io_uring_enter
 
 /* External C entrypoint: your compiler will provide main */
 .extern main
@@ -131,5 +138,78 @@ exit_group:
     /* never returns, but keep a ret for assembler sanity */
     ret
 
+/* ssize_t writev(int fd, const struct iovec *iov, int iovcnt) */
+writev:
+    mov rax, 20       /* __NR_writev = 20 */
+    syscall
+    ret
+
+/* long futex(int *uaddr, int op, int val, const struct timespec *timeout) */
+futex:
+    mov rax, 202      /* __NR_futex = 202 */
+    mov r10, rcx
+    syscall
+    ret
+
+/* long sched_getaffinity(pid_t pid, size_t len, void *mask)
+   - returns the mask size in bytes written by the kernel
+*/
+sched_getaffinity:
+    mov rax, 204      /* __NR_sched_getaffinity = 204 */
+    syscall
+    ret
+
+/* long clone_thread(int (*fn)(void*), void *arg, void *stack_top, int *tid)
+   - starts fn(arg) on stack_top sharing the address space and fds
+   - *tid is set in the parent and cleared (with a futex wake) when the
+     thread exits, so callers can join by waiting on it
+   - the child exits with __NR_exit, which only ends that thread
+*/
+clone_thread:
+    and rdx, -16
+    sub rdx, 16
+    mov qword ptr [rdx], rdi      /* fn and arg ride on the child stack */
+    mov qword ptr [rdx + 8], rsi
+    mov rsi, rdx                  /* child stack */
+    mov rdx, rcx                  /* parent_tid */
+    mov r10, rcx                  /* child_tid */
+    xor r8, r8                    /* tls */
+    /* CLONE_VM|FS|FILES|SIGHAND|THREAD|SYSVSEM|PARENT_SETTID|CHILD_CLEARTID */
+    mov edi, 0x350f00
+    mov rax, 56       /* __NR_clone = 56 */
+    syscall
+    test rax, rax
+    jnz .clone_parent
+    /* child: fresh stack, no frame chain */
+    xor rbp, rbp
+    pop rax
+    pop rdi
+    call rax
+    mov rdi, rax
+    mov rax, 60       /* __NR_exit = 60 */
+    syscall
+.clone_parent:
+    ret
+
+/* int rename(const char *oldpath, const char *newpath) */
+rename:
+    mov rax, 82       /* __NR_rename = 82 */
+    syscall
+    ret
+
+/* int io_uring_setup(unsigned entries, struct io_uring_params *p) */
+io_uring_setup:
+    mov rax, 425      /* __NR_io_uring_setup = 425 */
+    syscall
+    ret
+
+/* int io_uring_enter(int fd, unsigned to_submit, unsigned min_complete,
+                      unsigned flags, const void *sig, size_t sigsz) */
+io_uring_enter:
+    mov rax, 426      /* __NR_io_uring_enter = 426 */
+    mov r10, rcx
+    syscall
+    ret
+
 /* End of file */
 
@@ -0,0 +1,470 @@
+#include "superopt.h"
+#include "lstr.h"
+
+#include <unistd.h>
+#include <stdint.h>
+
+/* --- keys --- */
+
+typedef struct {
+    char* out;
+    size_t cap;
+    size_t len;
+    ast_node_t** vars;
+    int nvars;
+    int nodes;
+    int ok;
+} key_ctx_t;
+
+static void key_put(key_ctx_t* k, const char* s) {
+    size_t n = lstrlen(s);
+    if (k->len + n + 1 > k->cap) { k->ok = 0; return; }
+    for (size_t i = 0; i < n; ++i) k->out[k->len + i] = s[i];
+    k->len += n;
+}
+
+static int same_var(ast_node_t* a, ast_node_t* b) {
+    return a->name_len == b->name_len && lstrncmp(a->name, b->name, a->name_len) == 0;
+}
+
+/* variable index of a NODE_VAR within vars, -1 if not there */
+static int var_index(ast_node_t** vars, int nvars, ast_node_t* v) {
+    for (int i = 0; i < nvars; ++i) if (same_var(vars[i], v)) return i;
+    return -1;
+}
+
+static void key_node(key_ctx_t* k, ast_node_t* n) {
+    if (!k->ok) return;
+    if (!n || ++k->nodes > SUPEROPT_MAX_NODES) { k->ok = 0; return; }
+    if (n->type == NODE_INT) {
+        char buf[16];
+        litoa(n->int_value, buf);
+        key_put(k, buf);
+    } else if (n->type == NODE_VAR) {
+        int i = var_index(k->vars, k->nvars, n);
+        if (i < 0) {
+            if (k->nvars == 2) { k->ok = 0; return; }
+            i = k->nvars;
+            k->vars[k->nvars++] = n;
+        }
+        key_put(k, i ? "y" : "x");
+    } else if (n->type == NODE_BINOP && (n->op == OP_ADD || n->op == OP_SUB || n->op == OP_MUL)) {
+        key_put(k, n->op == OP_ADD ? "(+ " : n->op == OP_SUB ? "(- " : "(* ");
+        key_node(k, n->left);
+        key_put(k, " ");
+        key_node(k, n->right);
+        key_put(k, ")");
+    } else {
+        k->ok = 0;
+    }
+}
+
+size_t superopt_key(ast_node_t* expr, char* out, size_t cap, ast_node_t* vars[2]) {
+    if (!expr || expr->type != NODE_BINOP || cap == 0) return 0;
+    key_ctx_t k = { out, cap, 0, vars, 0, 0, 1 };
+    vars[0] = vars[1] = NULL;
+    key_node(&k, expr);
+    if (!k.ok || k.nvars == 0) return 0;
+    out[k.len] = '\0';
+    return k.len;
+}
+
+/* --- machine --- */
+
+enum { R_RAX, R_RCX, R_RDX, NREGS, R_NONE = NREGS };
+static const char* reg_names[NREGS] = { "rax", "rcx", "rdx" };
+
+/* cheap instructions first, so among sequences of one length the first hit
+   tends to be the cheapest */
+typedef enum { I_MOV, I_MOVI, I_ADD, I_ADDI, I_SUB, I_SUBI, I_LEA, I_SHL, I_NEG, I_IMUL, I_IMULI } insn_op_t;
+
+typedef struct {
+    uint8_t op;
+    uint8_t dst;
+    uint8_t src;     /* lea: base, R_NONE = none */
+    uint8_t idx;     /* lea only, R_NONE = none */
+    uint8_t scale;   /* lea scale, shl count */
+    int32_t imm;
+} insn_t;
+
+#define MAX_CONSTS ((SUPEROPT_MAX_NODES + 1) / 2)
+#define MAX_INSNS 4096
+#define NVEC 8        /* vectors every candidate runs on */
+#define NVEC_CHECK 64 /* more random vectors before the proof */
+
+static uint64_t insn_exec(const insn_t* in, const uint64_t* r) {
+    uint64_t d = r[in->dst];
+    uint64_t s = in->src < NREGS ? r[in->src] : 0;
+    uint64_t imm = (uint64_t) (int64_t) in->imm;
+    switch (in->op) {
+        case I_MOV: return s;
+        case I_MOVI: return imm;
+        case I_ADD: return d + s;
+        case I_ADDI: return d + imm;
+        case I_SUB: return d - s;
+        case I_SUBI: return d - imm;
+        case I_LEA: return s + (in->idx < NREGS ? r[in->idx] * in->scale : 0) + imm;
+        case I_SHL: return d << in->scale;
+        case I_NEG: return 0 - d;
+        case I_IMUL: return d * s;
+        case I_IMULI: return s * imm;
+        default: return d;
+    }
+}
+
+/* registers an instruction reads, as a mask */
+static unsigned insn_reads(const insn_t* in) {
+    unsigned m = 0;
+    switch (in->op) {
+        case I_MOV: case I_IMULI: m = 1u << in->src; break;
+        case I_MOVI: break;
+        case I_LEA:
+            if (in->src < NREGS) m |= 1u << in->src;
+            if (in->idx < NREGS) m |= 1u << in->idx;
+            break;
+        case I_ADD: case I_SUB: case I_IMUL: m = (1u << in->dst) | (1u << in->src); break;
+        default: m = 1u << in->dst; break;
+    }
+    return m;
+}
+
+/* per-variable degree bounds of register contents, for the proof */
+typedef struct { int dx, dy; } deg_t;
+
+static deg_t deg_max(deg_t a, deg_t b) {
+    deg_t r = { a.dx > b.dx ? a.dx : b.dx, a.dy > b.dy ? a.dy : b.dy };
+    return r;
+}
+
+static deg_t insn_deg(const insn_t* in, const deg_t* d) {
+    deg_t zero = { 0, 0 };
+    deg_t s = in->src < NREGS ? d[in->src] : zero;
+    switch (in->op) {
+        case I_MOV: case I_IMULI: return s;
+        case I_MOVI: return zero;
+        case I_ADD: case I_SUB: return deg_max(d[in->dst], s);
+        case I_LEA: return in->idx < NREGS ? deg_max(s, d[in->idx]) : s;
+        case I_IMUL: { deg_t r = { d[in->dst].dx + s.dx, d[in->dst].dy + s.dy }; return r; }
+        default: return d[in->dst];
+    }
+}
+
+static size_t gen_insns(insn_t* out, const int32_t* k, int nk) {
+    size_t n = 0;
+    insn_t in;
+#define EMIT_INSN(OP, D, S, I, SC, IMM) \
+    do { in.op = OP; in.dst = D; in.src = S; in.idx = I; in.scale = SC; in.imm = IMM; out[n++] = in; } while (0)
+    for (int d = 0; d < NREGS; ++d) {
+        for (int s = 0; s < NREGS; ++s) if (s != d) EMIT_INSN(I_MOV, d, s, R_NONE, 0, 0);
+        for (int c = 0; c < nk; ++c) EMIT_INSN(I_MOVI, d, R_NONE, R_NONE, 0, k[c]);
+        for (int s = 0; s < NREGS; ++s) EMIT_INSN(I_ADD, d, s, R_NONE, 0, 0);
+        for (int c = 0; c < nk; ++c) EMIT_INSN(I_ADDI, d, R_NONE, R_NONE, 0, k[c]);
+        for (int s = 0; s < NREGS; ++s) if (s != d) EMIT_INSN(I_SUB, d, s, R_NONE, 0, 0);
+        for (int c = 0; c < nk; ++c) EMIT_INSN(I_SUBI, d, R_NONE, R_NONE, 0, k[c]);
+        for (int b = 0; b <= NREGS; ++b) {
+            for (int c = -1; c < nk; ++c) {
+                int32_t disp = c < 0 ? 0 : k[c];
+                /* [base + disp] is a three-operand add */
+                if (b < NREGS && disp) EMIT_INSN(I_LEA, d, b, R_NONE, 1, disp);
+                for (int i = 0; i < NREGS; ++i) {
+                    for (int sc = 1; sc <= 8; sc <<= 1) {
+                        if (b == R_NONE && sc == 1) continue;   /* a mov or mov + add */
+                        EMIT_INSN(I_LEA, d, b, i, sc, disp);
+                    }
+                }
+            }
+        }
+        for (int sh = 1; sh <= 8; ++sh) EMIT_INSN(I_SHL, d, R_NONE, R_NONE, sh, 0);
+        EMIT_INSN(I_NEG, d, R_NONE, R_NONE, 0, 0);
+        for (int s = 0; s < NREGS; ++s) EMIT_INSN(I_IMUL, d, s, R_NONE, 0, 0);
+        for (int s = 0; s < NREGS; ++s) {
+            for (int c = 0; c < nk; ++c) if (k[c] > 1) EMIT_INSN(I_IMULI, d, s, R_NONE, 0, k[c]);
+        }
+    }
+#undef EMIT_INSN
+    return n;
+}
+
+/* --- target trees --- */
+
+static uint64_t tree_eval(ast_node_t* n, ast_node_t** vars, uint64_t x, uint64_t y) {
+    switch (n->type) {
+        case NODE_INT: return (uint64_t) (int64_t) n->int_value;
+        case NODE_VAR: return same_var(vars[0], n) ? x : y;
+        default: {
+            uint64_t a = tree_eval(n->left, vars, x, y);
+            uint64_t b = tree_eval(n->right, vars, x, y);
+            return n->op == OP_ADD ? a + b : n->op == OP_SUB ? a - b : a * b;
+        }
+    }
+}
+
+static deg_t tree_deg(ast_node_t* n, ast_node_t** vars) {
+    deg_t r = { 0, 0 };
+    if (n->type == NODE_VAR) {
+        if (same_var(vars[0], n)) r.dx = 1;
+        else r.dy = 1;
+    } else if (n->type == NODE_BINOP) {
+        deg_t a = tree_deg(n->left, vars), b = tree_deg(n->right, vars);
+        if (n->op == OP_MUL) { r.dx = a.dx + b.dx; r.dy = a.dy + b.dy; }
+        else r = deg_max(a, b);
+    }
+    return r;
+}
+
+/* instructions emit_expr spends on the tree */
+static int tree_cost(ast_node_t* n) {
+    if (n->type != NODE_BINOP) return 1;
+    return tree_cost(n->left) + tree_cost(n->right) + 2 + (n->op == OP_SUB ? 3 : 1);
+}
+
+static void tree_consts(ast_node_t* n, int32_t* k, int* nk) {
+    if (n->type == NODE_INT) {
+        for (int i = 0; i < *nk; ++i) if (k[i] == n->int_value) return;
+        if (*nk < MAX_CONSTS) k[(*nk)++] = n->int_value;
+    } else if (n->type == NODE_BINOP) {
+        tree_consts(n->left, k, nk);
+        tree_consts(n->right, k, nk);
+    }
+}
+
+/* --- search --- */
+
+typedef struct {
+    ast_node_t* tree;
+    ast_node_t** vars;
+    const insn_t* insns;
+    size_t ninsns;
+    int len;                        /* sequence length being enumerated */
+    uint64_t want[NVEC];
+    uint64_t in[NVEC][2];
+    uint64_t state[SUPEROPT_MAX_LEN + 1][NVEC][NREGS];
+    const insn_t* seq[SUPEROPT_MAX_LEN];
+    uint64_t rng;
+} search_t;
+
+static uint64_t next_rand(uint64_t* s) {
+    uint64_t x = *s;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    return *s = x;
+}
+
+static uint64_t seq_run(search_t* s, uint64_t x, uint64_t y) {
+    uint64_t r[NREGS] = { x, y, 0 };
+    for (int i = 0; i < s->len; ++i) r[s->seq[i]->dst] = insn_exec(s->seq[i], r);
+    return r[R_RAX];
+}
+
+/* full check of a candidate that matched the fast vectors */
+static int seq_verify(search_t* s) {
+    for (int v = 0; v < NVEC_CHECK; ++v) {
+        uint64_t x = next_rand(&s->rng), y = next_rand(&s->rng);
+        if (seq_run(s, x, y) != tree_eval(s->tree, s->vars, x, y)) return 0;
+    }
+    deg_t d[NREGS] = { { 1, 0 }, { 0, 1 }, { 0, 0 } };
+    for (int i = 0; i < s->len; ++i) d[s->seq[i]->dst] = insn_deg(s->seq[i], d);
+    deg_t bound = deg_max(d[R_RAX], tree_deg(s->tree, s->vars));
+    for (int a = 0; a <= bound.dx; ++a) {
+        for (int b = 0; b <= bound.dy; ++b) {
+            if (seq_run(s, (uint64_t) a, (uint64_t) b) != tree_eval(s->tree, s->vars, (uint64_t) a, (uint64_t) b)) return 0;
+        }
+    }
+    return 1;
+}
+
+/* the empty sequence: the tree reduces to x, which is already in rax */
+static int search_empty(search_t* s) {
+    for (int v = 0; v < NVEC; ++v) if (s->state[0][v][R_RAX] != s->want[v]) return 0;
+    return seq_verify(s);
+}
+
+static int search_depth(search_t* s, int depth, unsigned defined) {
+    for (size_t i = 0; i < s->ninsns; ++i) {
+        const insn_t* in = &s->insns[i];
+        if ((insn_reads(in) & ~defined) != 0) continue;
+        /* the result has to end up in rax */
+        if (depth == s->len - 1 && in->dst != R_RAX) continue;
+        int match = 1;
+        for (int v = 0; v < NVEC; ++v) {
+            uint64_t* cur = s->state[depth][v];
+            uint64_t* nxt = s->state[depth + 1][v];
+            nxt[R_RAX] = cur[R_RAX]; nxt[R_RCX] = cur[R_RCX]; nxt[R_RDX] = cur[R_RDX];
+            nxt[in->dst] = insn_exec(in, cur);
+            if (depth == s->len - 1 && nxt[R_RAX] != s->want[v]) { match = 0; break; }
+        }
+        if (!match) continue;
+        s->seq[depth] = in;
+        if (depth == s->len - 1) {
+            if (seq_verify(s)) return 1;
+        } else if (search_depth(s, depth + 1, defined | (1u << in->dst))) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void seq_format(const insn_t* in, char* out) {
+    static const char* mnemonic[] = { "mov", "mov", "add", "add", "sub", "sub", "lea", "shl", "neg", "imul", "imul" };
+    char num[16];
+    lstrcpy(out, mnemonic[in->op]);
+    lstrcat(out, " ");
+    lstrcat(out, reg_names[in->dst]);
+    switch (in->op) {
+        case I_MOV: case I_ADD: case I_SUB: case I_IMUL:
+            lstrcat(out, ", ");
+            lstrcat(out, reg_names[in->src]);
+            break;
+        case I_MOVI: case I_ADDI: case I_SUBI:
+            litoa(in->imm, num);
+            lstrcat(out, ", ");
+            lstrcat(out, num);
+            break;
+        case I_IMULI:
+            litoa(in->imm, num);
+            lstrcat(out, ", ");
+            lstrcat(out, reg_names[in->src]);
+            lstrcat(out, ", ");
+            lstrcat(out, num);
+            break;
+        case I_SHL:
+            litoa(in->scale, num);
+            lstrcat(out, ", ");
+            lstrcat(out, num);
+            break;
+        case I_LEA:
+            lstrcat(out, ", [");
+            if (in->src < NREGS) lstrcat(out, reg_names[in->src]);
+            if (in->idx < NREGS) {
+                if (in->src < NREGS) lstrcat(out, " + ");
+                lstrcat(out, reg_names[in->idx]);
+                if (in->scale > 1) {
+                    litoa(in->scale, num);
+                    lstrcat(out, "*");
+                    lstrcat(out, num);
+                }
+            }
+            if (in->imm) {
+                litoa(in->imm, num);
+                lstrcat(out, " + ");
+                lstrcat(out, num);
+            }
+            lstrcat(out, "]");
+            break;
+        default: break;
+    }
+}
+
+/* --- driver --- */
+
+typedef struct {
+    int out_fd;
+    void* (*alloc)(size_t);
+    void (*free_fn)(void*);
+    char** seen;        /* keys already searched */
+    size_t nseen;
+    size_t seen_cap;
+    insn_t* insns;
+    int found;
+} run_t;
+
+/* remember key; returns 0 if it was already there */
+static int mark_seen(run_t* r, const char* key, size_t len) {
+    for (size_t i = 0; i < r->nseen; ++i) if (lstrcmp(r->seen[i], key) == 0) return 0;
+    if (r->nseen == r->seen_cap) {
+        size_t newcap = r->seen_cap ? r->seen_cap * 2 : 64;
+        char** ns = (char**) r->alloc(sizeof(char*) * newcap);
+        if (!ns) return 0;
+        for (size_t i = 0; i < r->nseen; ++i) ns[i] = r->seen[i];
+        if (r->seen) r->free_fn(r->seen);
+        r->seen = ns;
+        r->seen_cap = newcap;
+    }
+    char* copy = (char*) r->alloc(len + 1);
+    if (!copy) return 0;
+    lstrcpy(copy, key);
+    r->seen[r->nseen++] = copy;
+    return 1;
+}
+
+static void optimize_tree(run_t* r, ast_node_t* tree) {
+    char key[SUPEROPT_KEY_MAX];
+    ast_node_t* vars[2];
+    size_t klen = superopt_key(tree, key, sizeof(key), vars);
+    if (!klen || !mark_seen(r, key, klen)) return;
+    int nvars = vars[1] ? 2 : 1;
+
+    /* only worth it when the rewrite, loads included, is strictly shorter */
+    int max_len = tree_cost(tree) - nvars - 1;
+    if (max_len > SUPEROPT_MAX_LEN) max_len = SUPEROPT_MAX_LEN;
+    if (max_len < 0) return;
+
+    int32_t k[MAX_CONSTS];
+    int nk = 0;
+    tree_consts(tree, k, &nk);
+
+    static search_t s;
+    s.tree = tree;
+    s.vars = vars;
+    s.insns = r->insns;
+    s.ninsns = gen_insns(r->insns, k, nk);
+    s.rng = 0x9e3779b97f4a7c15ULL;
+    for (int v = 0; v < NVEC; ++v) {
+        uint64_t x = next_rand(&s.rng), y = nvars > 1 ? next_rand(&s.rng) : 0;
+        s.state[0][v][R_RAX] = x;
+        s.state[0][v][R_RCX] = y;
+        s.state[0][v][R_RDX] = 0;
+        s.want[v] = tree_eval(tree, vars, x, y);
+    }
+    unsigned defined = nvars > 1 ? (1u << R_RAX) | (1u << R_RCX) : 1u << R_RAX;
+    for (s.len = 0; s.len <= max_len; ++s.len) {
+        if (!(s.len ? search_depth(&s, 0, defined) : search_empty(&s))) continue;
+        char line[SUPEROPT_KEY_MAX + 64 * SUPEROPT_MAX_LEN];
+        lstrcpy(line, key);
+        lstrcat(line, "\t");
+        for (int i = 0; i < s.len; ++i) {
+            char insn[64];
+            seq_format(s.seq[i], insn);
+            if (i) lstrcat(line, "; ");
+            lstrcat(line, insn);
+        }
+        lstrcat(line, "\n");
+        lwrite_all(r->out_fd, line, lstrlen(line));
+        r->found++;
+        return;
+    }
+}
+
+/* every expression node, outermost first */
+static void walk_expr(run_t* r, ast_node_t* n) {
+    if (!n) return;
+    if (n->type == NODE_BINOP) {
+        optimize_tree(r, n);
+        walk_expr(r, n->left);
+        walk_expr(r, n->right);
+    } else if (n->type == NODE_CALL) {
+        for (ast_node_t* a = n->left; a; a = a->next) walk_expr(r, a);
+    }
+}
+
+static void walk_stmts(run_t* r, ast_node_t* st) {
+    for (; st; st = st->next) {
+        if (st->type == NODE_ASSIGN || st->type == NODE_RETURN) walk_expr(r, st->left);
+        else if (st->type == NODE_CALL) walk_expr(r, st);
+        else if (st->type == NODE_FUNC) walk_stmts(r, st->right);
+    }
+}
+
+int superopt_run(ast_node_t* prog, int out_fd, void* (*alloc)(size_t), void (*free_fn)(void*)) {
+    run_t r = { out_fd, alloc, free_fn, NULL, 0, 0, NULL, 0 };
+    r.insns = (insn_t*) alloc(sizeof(insn_t) * MAX_INSNS);
+    if (!r.insns) return 0;
+    const char* hdr = "# lsys rewrite db: key<TAB>sequence (x in rax, y in rcx, result in rax, rdx scratch)\n";
+    lwrite_all(out_fd, hdr, lstrlen(hdr));
+    walk_stmts(&r, prog);
+    for (size_t i = 0; i < r.nseen; ++i) free_fn(r.seen[i]);
+    if (r.seen) free_fn(r.seen);
+    free_fn(r.insns);
+    return r.found;
+}